@@ -0,0 +1,30 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/brick_min_max.cc" "CMakeFiles/scalar_polygonization.dir/src/brick_min_max.cc.o" "gcc" "CMakeFiles/scalar_polygonization.dir/src/brick_min_max.cc.o.d"
+  "/root/repo/src/classification.cc" "CMakeFiles/scalar_polygonization.dir/src/classification.cc.o" "gcc" "CMakeFiles/scalar_polygonization.dir/src/classification.cc.o.d"
+  "/root/repo/src/compressed_mesh.cc" "CMakeFiles/scalar_polygonization.dir/src/compressed_mesh.cc.o" "gcc" "CMakeFiles/scalar_polygonization.dir/src/compressed_mesh.cc.o.d"
+  "/root/repo/src/edge_index_cache.cc" "CMakeFiles/scalar_polygonization.dir/src/edge_index_cache.cc.o" "gcc" "CMakeFiles/scalar_polygonization.dir/src/edge_index_cache.cc.o.d"
+  "/root/repo/src/float_to_text.cc" "CMakeFiles/scalar_polygonization.dir/src/float_to_text.cc.o" "gcc" "CMakeFiles/scalar_polygonization.dir/src/float_to_text.cc.o.d"
+  "/root/repo/src/marching_cubes.cc" "CMakeFiles/scalar_polygonization.dir/src/marching_cubes.cc.o" "gcc" "CMakeFiles/scalar_polygonization.dir/src/marching_cubes.cc.o.d"
+  "/root/repo/src/mesh_io.cc" "CMakeFiles/scalar_polygonization.dir/src/mesh_io.cc.o" "gcc" "CMakeFiles/scalar_polygonization.dir/src/mesh_io.cc.o.d"
+  "/root/repo/src/polygonize_volume.cc" "CMakeFiles/scalar_polygonization.dir/src/polygonize_volume.cc.o" "gcc" "CMakeFiles/scalar_polygonization.dir/src/polygonize_volume.cc.o.d"
+  "/root/repo/src/span_space_index.cc" "CMakeFiles/scalar_polygonization.dir/src/span_space_index.cc.o" "gcc" "CMakeFiles/scalar_polygonization.dir/src/span_space_index.cc.o.d"
+  "/root/repo/src/sparse_volume.cc" "CMakeFiles/scalar_polygonization.dir/src/sparse_volume.cc.o" "gcc" "CMakeFiles/scalar_polygonization.dir/src/sparse_volume.cc.o.d"
+  "/root/repo/src/vec3.cc" "CMakeFiles/scalar_polygonization.dir/src/vec3.cc.o" "gcc" "CMakeFiles/scalar_polygonization.dir/src/vec3.cc.o.d"
+  "/root/repo/src/volume_file.cc" "CMakeFiles/scalar_polygonization.dir/src/volume_file.cc.o" "gcc" "CMakeFiles/scalar_polygonization.dir/src/volume_file.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
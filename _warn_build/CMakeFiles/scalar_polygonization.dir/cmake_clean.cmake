@@ -0,0 +1,33 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/scalar_polygonization.dir/src/brick_min_max.cc.o"
+  "CMakeFiles/scalar_polygonization.dir/src/brick_min_max.cc.o.d"
+  "CMakeFiles/scalar_polygonization.dir/src/classification.cc.o"
+  "CMakeFiles/scalar_polygonization.dir/src/classification.cc.o.d"
+  "CMakeFiles/scalar_polygonization.dir/src/compressed_mesh.cc.o"
+  "CMakeFiles/scalar_polygonization.dir/src/compressed_mesh.cc.o.d"
+  "CMakeFiles/scalar_polygonization.dir/src/edge_index_cache.cc.o"
+  "CMakeFiles/scalar_polygonization.dir/src/edge_index_cache.cc.o.d"
+  "CMakeFiles/scalar_polygonization.dir/src/float_to_text.cc.o"
+  "CMakeFiles/scalar_polygonization.dir/src/float_to_text.cc.o.d"
+  "CMakeFiles/scalar_polygonization.dir/src/marching_cubes.cc.o"
+  "CMakeFiles/scalar_polygonization.dir/src/marching_cubes.cc.o.d"
+  "CMakeFiles/scalar_polygonization.dir/src/mesh_io.cc.o"
+  "CMakeFiles/scalar_polygonization.dir/src/mesh_io.cc.o.d"
+  "CMakeFiles/scalar_polygonization.dir/src/polygonize_volume.cc.o"
+  "CMakeFiles/scalar_polygonization.dir/src/polygonize_volume.cc.o.d"
+  "CMakeFiles/scalar_polygonization.dir/src/span_space_index.cc.o"
+  "CMakeFiles/scalar_polygonization.dir/src/span_space_index.cc.o.d"
+  "CMakeFiles/scalar_polygonization.dir/src/sparse_volume.cc.o"
+  "CMakeFiles/scalar_polygonization.dir/src/sparse_volume.cc.o.d"
+  "CMakeFiles/scalar_polygonization.dir/src/vec3.cc.o"
+  "CMakeFiles/scalar_polygonization.dir/src/vec3.cc.o.d"
+  "CMakeFiles/scalar_polygonization.dir/src/volume_file.cc.o"
+  "CMakeFiles/scalar_polygonization.dir/src/volume_file.cc.o.d"
+  "libscalar_polygonization.pdb"
+  "libscalar_polygonization.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/scalar_polygonization.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
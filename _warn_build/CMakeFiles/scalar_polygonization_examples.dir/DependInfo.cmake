@@ -0,0 +1,25 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/examples/array.cc" "CMakeFiles/scalar_polygonization_examples.dir/examples/array.cc.o" "gcc" "CMakeFiles/scalar_polygonization_examples.dir/examples/array.cc.o.d"
+  "/root/repo/examples/grid.cc" "CMakeFiles/scalar_polygonization_examples.dir/examples/grid.cc.o" "gcc" "CMakeFiles/scalar_polygonization_examples.dir/examples/grid.cc.o.d"
+  "/root/repo/examples/marching_cubes.cc" "CMakeFiles/scalar_polygonization_examples.dir/examples/marching_cubes.cc.o" "gcc" "CMakeFiles/scalar_polygonization_examples.dir/examples/marching_cubes.cc.o.d"
+  "/root/repo/examples/marching_cubes_rectangular_domain.cc" "CMakeFiles/scalar_polygonization_examples.dir/examples/marching_cubes_rectangular_domain.cc.o" "gcc" "CMakeFiles/scalar_polygonization_examples.dir/examples/marching_cubes_rectangular_domain.cc.o.d"
+  "/root/repo/examples/mat3.cc" "CMakeFiles/scalar_polygonization_examples.dir/examples/mat3.cc.o" "gcc" "CMakeFiles/scalar_polygonization_examples.dir/examples/mat3.cc.o.d"
+  "/root/repo/examples/stencil.cc" "CMakeFiles/scalar_polygonization_examples.dir/examples/stencil.cc.o" "gcc" "CMakeFiles/scalar_polygonization_examples.dir/examples/stencil.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_warn_build/CMakeFiles/scalar_polygonization.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
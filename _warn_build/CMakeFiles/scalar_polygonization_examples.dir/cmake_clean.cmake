@@ -0,0 +1,21 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/scalar_polygonization_examples.dir/examples/array.cc.o"
+  "CMakeFiles/scalar_polygonization_examples.dir/examples/array.cc.o.d"
+  "CMakeFiles/scalar_polygonization_examples.dir/examples/grid.cc.o"
+  "CMakeFiles/scalar_polygonization_examples.dir/examples/grid.cc.o.d"
+  "CMakeFiles/scalar_polygonization_examples.dir/examples/marching_cubes.cc.o"
+  "CMakeFiles/scalar_polygonization_examples.dir/examples/marching_cubes.cc.o.d"
+  "CMakeFiles/scalar_polygonization_examples.dir/examples/marching_cubes_rectangular_domain.cc.o"
+  "CMakeFiles/scalar_polygonization_examples.dir/examples/marching_cubes_rectangular_domain.cc.o.d"
+  "CMakeFiles/scalar_polygonization_examples.dir/examples/mat3.cc.o"
+  "CMakeFiles/scalar_polygonization_examples.dir/examples/mat3.cc.o.d"
+  "CMakeFiles/scalar_polygonization_examples.dir/examples/stencil.cc.o"
+  "CMakeFiles/scalar_polygonization_examples.dir/examples/stencil.cc.o.d"
+  "scalar_polygonization_examples"
+  "scalar_polygonization_examples.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/scalar_polygonization_examples.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
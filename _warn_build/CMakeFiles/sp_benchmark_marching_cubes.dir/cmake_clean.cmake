@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sp_benchmark_marching_cubes.dir/benchmarks/marching_cubes.cc.o"
+  "CMakeFiles/sp_benchmark_marching_cubes.dir/benchmarks/marching_cubes.cc.o.d"
+  "sp_benchmark_marching_cubes"
+  "sp_benchmark_marching_cubes.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sp_benchmark_marching_cubes.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sp_benchmark_polygonize_volume.dir/benchmarks/polygonize_volume.cc.o"
+  "CMakeFiles/sp_benchmark_polygonize_volume.dir/benchmarks/polygonize_volume.cc.o.d"
+  "sp_benchmark_polygonize_volume"
+  "sp_benchmark_polygonize_volume.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sp_benchmark_polygonize_volume.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
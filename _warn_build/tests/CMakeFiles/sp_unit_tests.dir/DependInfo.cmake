@@ -0,0 +1,41 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/examples/array.cc" "tests/CMakeFiles/sp_unit_tests.dir/__/examples/array.cc.o" "gcc" "tests/CMakeFiles/sp_unit_tests.dir/__/examples/array.cc.o.d"
+  "/root/repo/examples/grid.cc" "tests/CMakeFiles/sp_unit_tests.dir/__/examples/grid.cc.o" "gcc" "tests/CMakeFiles/sp_unit_tests.dir/__/examples/grid.cc.o.d"
+  "/root/repo/examples/mat3.cc" "tests/CMakeFiles/sp_unit_tests.dir/__/examples/mat3.cc.o" "gcc" "tests/CMakeFiles/sp_unit_tests.dir/__/examples/mat3.cc.o.d"
+  "/root/repo/examples/stencil.cc" "tests/CMakeFiles/sp_unit_tests.dir/__/examples/stencil.cc.o" "gcc" "tests/CMakeFiles/sp_unit_tests.dir/__/examples/stencil.cc.o.d"
+  "/root/repo/tests/brick-min-max.cc" "tests/CMakeFiles/sp_unit_tests.dir/brick-min-max.cc.o" "gcc" "tests/CMakeFiles/sp_unit_tests.dir/brick-min-max.cc.o.d"
+  "/root/repo/tests/classification.cc" "tests/CMakeFiles/sp_unit_tests.dir/classification.cc.o" "gcc" "tests/CMakeFiles/sp_unit_tests.dir/classification.cc.o.d"
+  "/root/repo/tests/compressed-mesh.cc" "tests/CMakeFiles/sp_unit_tests.dir/compressed-mesh.cc.o" "gcc" "tests/CMakeFiles/sp_unit_tests.dir/compressed-mesh.cc.o.d"
+  "/root/repo/tests/edge-index-cache.cc" "tests/CMakeFiles/sp_unit_tests.dir/edge-index-cache.cc.o" "gcc" "tests/CMakeFiles/sp_unit_tests.dir/edge-index-cache.cc.o.d"
+  "/root/repo/tests/examples/stencil.cc" "tests/CMakeFiles/sp_unit_tests.dir/examples/stencil.cc.o" "gcc" "tests/CMakeFiles/sp_unit_tests.dir/examples/stencil.cc.o.d"
+  "/root/repo/tests/float-to-text.cc" "tests/CMakeFiles/sp_unit_tests.dir/float-to-text.cc.o" "gcc" "tests/CMakeFiles/sp_unit_tests.dir/float-to-text.cc.o.d"
+  "/root/repo/tests/marching-cubes.cc" "tests/CMakeFiles/sp_unit_tests.dir/marching-cubes.cc.o" "gcc" "tests/CMakeFiles/sp_unit_tests.dir/marching-cubes.cc.o.d"
+  "/root/repo/tests/mesh-io.cc" "tests/CMakeFiles/sp_unit_tests.dir/mesh-io.cc.o" "gcc" "tests/CMakeFiles/sp_unit_tests.dir/mesh-io.cc.o.d"
+  "/root/repo/tests/parallel.cc" "tests/CMakeFiles/sp_unit_tests.dir/parallel.cc.o" "gcc" "tests/CMakeFiles/sp_unit_tests.dir/parallel.cc.o.d"
+  "/root/repo/tests/polygonize-function.cc" "tests/CMakeFiles/sp_unit_tests.dir/polygonize-function.cc.o" "gcc" "tests/CMakeFiles/sp_unit_tests.dir/polygonize-function.cc.o.d"
+  "/root/repo/tests/polygonize-stream.cc" "tests/CMakeFiles/sp_unit_tests.dir/polygonize-stream.cc.o" "gcc" "tests/CMakeFiles/sp_unit_tests.dir/polygonize-stream.cc.o.d"
+  "/root/repo/tests/polygonize-volume.cc" "tests/CMakeFiles/sp_unit_tests.dir/polygonize-volume.cc.o" "gcc" "tests/CMakeFiles/sp_unit_tests.dir/polygonize-volume.cc.o.d"
+  "/root/repo/tests/span-space-index.cc" "tests/CMakeFiles/sp_unit_tests.dir/span-space-index.cc.o" "gcc" "tests/CMakeFiles/sp_unit_tests.dir/span-space-index.cc.o.d"
+  "/root/repo/tests/sparse-volume.cc" "tests/CMakeFiles/sp_unit_tests.dir/sparse-volume.cc.o" "gcc" "tests/CMakeFiles/sp_unit_tests.dir/sparse-volume.cc.o.d"
+  "/root/repo/tests/vec3.cc" "tests/CMakeFiles/sp_unit_tests.dir/vec3.cc.o" "gcc" "tests/CMakeFiles/sp_unit_tests.dir/vec3.cc.o.d"
+  "/root/repo/tests/volume-file.cc" "tests/CMakeFiles/sp_unit_tests.dir/volume-file.cc.o" "gcc" "tests/CMakeFiles/sp_unit_tests.dir/volume-file.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_warn_build/CMakeFiles/scalar_polygonization.dir/DependInfo.cmake"
+  "/root/repo/_warn_build/ext/googletest/googletest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  "/root/repo/_warn_build/ext/googletest/googletest/CMakeFiles/gtest_main.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,49 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sp_unit_tests.dir/__/examples/array.cc.o"
+  "CMakeFiles/sp_unit_tests.dir/__/examples/array.cc.o.d"
+  "CMakeFiles/sp_unit_tests.dir/__/examples/grid.cc.o"
+  "CMakeFiles/sp_unit_tests.dir/__/examples/grid.cc.o.d"
+  "CMakeFiles/sp_unit_tests.dir/__/examples/mat3.cc.o"
+  "CMakeFiles/sp_unit_tests.dir/__/examples/mat3.cc.o.d"
+  "CMakeFiles/sp_unit_tests.dir/__/examples/stencil.cc.o"
+  "CMakeFiles/sp_unit_tests.dir/__/examples/stencil.cc.o.d"
+  "CMakeFiles/sp_unit_tests.dir/brick-min-max.cc.o"
+  "CMakeFiles/sp_unit_tests.dir/brick-min-max.cc.o.d"
+  "CMakeFiles/sp_unit_tests.dir/classification.cc.o"
+  "CMakeFiles/sp_unit_tests.dir/classification.cc.o.d"
+  "CMakeFiles/sp_unit_tests.dir/compressed-mesh.cc.o"
+  "CMakeFiles/sp_unit_tests.dir/compressed-mesh.cc.o.d"
+  "CMakeFiles/sp_unit_tests.dir/edge-index-cache.cc.o"
+  "CMakeFiles/sp_unit_tests.dir/edge-index-cache.cc.o.d"
+  "CMakeFiles/sp_unit_tests.dir/examples/stencil.cc.o"
+  "CMakeFiles/sp_unit_tests.dir/examples/stencil.cc.o.d"
+  "CMakeFiles/sp_unit_tests.dir/float-to-text.cc.o"
+  "CMakeFiles/sp_unit_tests.dir/float-to-text.cc.o.d"
+  "CMakeFiles/sp_unit_tests.dir/marching-cubes.cc.o"
+  "CMakeFiles/sp_unit_tests.dir/marching-cubes.cc.o.d"
+  "CMakeFiles/sp_unit_tests.dir/mesh-io.cc.o"
+  "CMakeFiles/sp_unit_tests.dir/mesh-io.cc.o.d"
+  "CMakeFiles/sp_unit_tests.dir/parallel.cc.o"
+  "CMakeFiles/sp_unit_tests.dir/parallel.cc.o.d"
+  "CMakeFiles/sp_unit_tests.dir/polygonize-function.cc.o"
+  "CMakeFiles/sp_unit_tests.dir/polygonize-function.cc.o.d"
+  "CMakeFiles/sp_unit_tests.dir/polygonize-stream.cc.o"
+  "CMakeFiles/sp_unit_tests.dir/polygonize-stream.cc.o.d"
+  "CMakeFiles/sp_unit_tests.dir/polygonize-volume.cc.o"
+  "CMakeFiles/sp_unit_tests.dir/polygonize-volume.cc.o.d"
+  "CMakeFiles/sp_unit_tests.dir/span-space-index.cc.o"
+  "CMakeFiles/sp_unit_tests.dir/span-space-index.cc.o.d"
+  "CMakeFiles/sp_unit_tests.dir/sparse-volume.cc.o"
+  "CMakeFiles/sp_unit_tests.dir/sparse-volume.cc.o.d"
+  "CMakeFiles/sp_unit_tests.dir/vec3.cc.o"
+  "CMakeFiles/sp_unit_tests.dir/vec3.cc.o.d"
+  "CMakeFiles/sp_unit_tests.dir/volume-file.cc.o"
+  "CMakeFiles/sp_unit_tests.dir/volume-file.cc.o.d"
+  "sp_unit_tests"
+  "sp_unit_tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sp_unit_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests
+# Build directory: /root/repo/_warn_build/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(sp_unit_tests "/root/repo/_warn_build/tests/sp_unit_tests")
+set_tests_properties(sp_unit_tests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;49;ADD_TEST;/root/repo/tests/CMakeLists.txt;0;")
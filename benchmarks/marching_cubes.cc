@@ -0,0 +1,153 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright 2019 Lakshman Anumolu.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///////////////////////////////////////////////////////////////////////////////
+
+#include "scalar_polygonization/marching_cubes.h"
+#include "scalar_polygonization/tables.h"
+#include "scalar_polygonization/vec3.h"
+
+#include <array>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+namespace SP = SCALAR_POLYGONIZATION;
+
+namespace
+{
+using T = float;
+
+/*! Scalar field of a sphere sampled on `n^3` nodes of a unit cube.
+ */
+std::vector<T> sphereField(const int n)
+{
+  std::vector<T> field(static_cast<size_t>(n) * n * n);
+  const T dx = static_cast<T>(1.) / (n - 1);
+
+  for (int k = 0; k < n; ++k)
+    for (int j = 0; j < n; ++j)
+      for (int i = 0; i < n; ++i) {
+        const T x = i * dx - 0.5, y = j * dx - 0.5, z = k * dx - 0.5;
+        field[(static_cast<size_t>(k) * n + j) * n + i] = x * x + y * y + z * z - 0.09;
+      }
+
+  return field;
+}
+
+template <typename F>
+void report(const std::string& name, const int n, const int repeat, F&& run)
+{
+  size_t num_triangles = 0;
+
+  const auto start = std::chrono::steady_clock::now();
+  for (int r = 0; r < repeat; ++r) num_triangles = run();
+  const auto end = std::chrono::steady_clock::now();
+
+  const double seconds = std::chrono::duration<double>(end - start).count();
+  const double cells = static_cast<double>(n - 1) * (n - 1) * (n - 1) * repeat;
+
+  std::cout << name << ": " << cells / seconds << " cells/s (" << num_triangles << " triangles, " << seconds
+            << " s)" << std::endl;
+}
+}  // namespace
+
+int main(int argc, char** argv)
+{
+  const int n = argc > 1 ? std::atoi(argv[1]) : 128;
+  const int repeat = argc > 2 ? std::atoi(argv[2]) : 3;
+
+  const auto field = sphereField(n);
+  const T dx = static_cast<T>(1.) / (n - 1);
+  const size_t offset = field.size();
+
+  SP::MarchingCubes<T> mc;
+
+  std::cout << "Marching cubes on " << n << "^3 nodes" << std::endl;
+
+  report("marchCube (std::vector)", n, repeat, [&]() {
+    size_t num_triangles = 0;
+    std::vector<size_t> vertex_ids(8);
+    std::vector<SP::Vec3<T>> cube_vertices(8);
+    std::vector<T> scalars(8);
+    std::vector<SP::Vec3<T>> normals(8);
+
+    for (int k = 0; k < n - 1; ++k)
+      for (int j = 0; j < n - 1; ++j)
+        for (int i = 0; i < n - 1; ++i) {
+          for (int v = 0; v < 8; ++v) {
+            const int iv = i + static_cast<int>(SP::vertex_offset[v][0]);
+            const int jv = j + static_cast<int>(SP::vertex_offset[v][1]);
+            const int kv = k + static_cast<int>(SP::vertex_offset[v][2]);
+            vertex_ids[v] = (static_cast<size_t>(kv) * n + jv) * n + iv;
+            cube_vertices[v] = SP::Vec3<T>(iv * dx, jv * dx, kv * dx);
+            scalars[v] = field[vertex_ids[v]];
+          }
+
+          const auto edge_ids = mc.vertexToEdgeIds(offset, vertex_ids);
+          const auto triangle_vertex_tuple = mc.marchCube(cube_vertices, edge_ids, scalars, normals, 0);
+          num_triangles += std::get<SP::TRIANGLES>(triangle_vertex_tuple).size();
+        }
+
+    return num_triangles;
+  });
+
+  report("marchCube (CubeTriangulation)", n, repeat, [&]() {
+    size_t num_triangles = 0;
+    std::array<size_t, 8> vertex_ids;
+    std::array<SP::Vec3<T>, 8> cube_vertices;
+    std::array<T, 8> scalars;
+    std::array<SP::Vec3<T>, 8> normals;
+    std::array<size_t, 12> edge_ids;
+    SP::CubeTriangulation<T> triangulation;
+
+    for (int k = 0; k < n - 1; ++k)
+      for (int j = 0; j < n - 1; ++j)
+        for (int i = 0; i < n - 1; ++i) {
+          for (int v = 0; v < 8; ++v) {
+            const int iv = i + static_cast<int>(SP::vertex_offset[v][0]);
+            const int jv = j + static_cast<int>(SP::vertex_offset[v][1]);
+            const int kv = k + static_cast<int>(SP::vertex_offset[v][2]);
+            vertex_ids[v] = (static_cast<size_t>(kv) * n + jv) * n + iv;
+            cube_vertices[v] = SP::Vec3<T>(iv * dx, jv * dx, kv * dx);
+            scalars[v] = field[vertex_ids[v]];
+          }
+
+          if (!mc.marchCube(cube_vertices, scalars, normals, 0, triangulation)) continue;
+
+          mc.vertexToEdgeIds(offset, vertex_ids.data(), edge_ids.data());
+          num_triangles += triangulation.num_triangles;
+        }
+
+    return num_triangles;
+  });
+
+  return 0;
+}
@@ -0,0 +1,176 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright 2019 Lakshman Anumolu.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///////////////////////////////////////////////////////////////////////////////
+
+#include "scalar_polygonization/brick_min_max.h"
+#include "scalar_polygonization/parallel.h"
+#include "scalar_polygonization/polygonize_function.h"
+#include "scalar_polygonization/polygonize_volume.h"
+#include "scalar_polygonization/span_space_index.h"
+#include "scalar_polygonization/vec3.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+namespace SP = SCALAR_POLYGONIZATION;
+
+int main(int argc, char** argv)
+{
+  using T = float;
+
+  const int n = argc > 1 ? std::atoi(argv[1]) : 256;
+  const unsigned num_threads = SP::numThreads(argc > 2 ? std::atoi(argv[2]) : 0);
+
+  // Sphere in a unit cube.
+  std::vector<T> field(static_cast<size_t>(n) * n * n);
+  const T dx = static_cast<T>(1.) / (n - 1);
+  for (int k = 0; k < n; ++k)
+    for (int j = 0; j < n; ++j)
+      for (int i = 0; i < n; ++i) {
+        const T x = i * dx - 0.5, y = j * dx - 0.5, z = k * dx - 0.5;
+        field[(static_cast<size_t>(k) * n + j) * n + i] = x * x + y * y + z * z - 0.09;
+      }
+
+  const SP::ScalarVolume<T> volume(field.data(), SP::Vec3<int>(n, n, n), SP::Vec3<T>(0, 0, 0),
+                                   SP::Vec3<T>(dx, dx, dx));
+  const double cells = static_cast<double>(n - 1) * (n - 1) * (n - 1);
+
+  std::cout << "polygonizeVolume on " << n << "^3 nodes" << std::endl;
+
+  using Extraction = SP::PolygonizeOptions::Extraction;
+  for (const Extraction extraction : {Extraction::SINGLE_PASS, Extraction::COUNT_THEN_FILL})
+    for (const unsigned threads : {1u, num_threads}) {
+      SP::PolygonizeOptions options;
+      options.num_threads = threads;
+      options.extraction = extraction;
+
+      const auto start = std::chrono::steady_clock::now();
+      const auto mesh = SP::polygonizeVolume(volume, static_cast<T>(0.), options);
+      const auto end = std::chrono::steady_clock::now();
+
+      const double seconds = std::chrono::duration<double>(end - start).count();
+      std::cout << (extraction == Extraction::SINGLE_PASS ? "single pass, " : "count then fill, ") << threads
+                << " thread(s): " << cells / seconds << " cells/s (" << mesh.numTriangles() << " triangles, "
+                << seconds << " s)" << std::endl;
+    }
+
+  // Bricks away from the sphere are skipped, build time of the brick ranges is reported separately.
+  for (const unsigned threads : {1u, num_threads}) {
+    SP::PolygonizeOptions options;
+    options.num_threads = threads;
+
+    const auto start = std::chrono::steady_clock::now();
+    const SP::BrickMinMax<T> bricks(volume, threads);
+    const auto built = std::chrono::steady_clock::now();
+    const auto mesh = SP::polygonizeVolume(volume, bricks, static_cast<T>(0.), options);
+    const auto end = std::chrono::steady_clock::now();
+
+    const double seconds = std::chrono::duration<double>(end - built).count();
+    std::cout << "bricks, " << threads << " thread(s): " << cells / seconds << " cells/s (" << mesh.numTriangles()
+              << " triangles, " << seconds << " s, " << std::chrono::duration<double>(built - start).count()
+              << " s to build bricks)" << std::endl;
+  }
+
+  // Several iso-values in one pass against one pass per iso-value.
+  {
+    const std::vector<T> iso_alphas = {-0.08, 0., 0.1};
+    SP::PolygonizeOptions options;
+    options.num_threads = num_threads;
+
+    const auto start = std::chrono::steady_clock::now();
+    size_t num_triangles = 0;
+    for (const T iso_alpha : iso_alphas)
+      num_triangles += SP::polygonizeVolume(volume, iso_alpha, options).numTriangles();
+    const auto separate = std::chrono::steady_clock::now();
+    for (const auto& mesh : SP::polygonizeVolume(volume, iso_alphas, options)) num_triangles -= mesh.numTriangles();
+    const auto end = std::chrono::steady_clock::now();
+
+    std::cout << iso_alphas.size() << " iso-values, " << num_threads
+              << " thread(s): " << std::chrono::duration<double>(separate - start).count() << " s separately, "
+              << std::chrono::duration<double>(end - separate).count() << " s in one pass"
+              << (num_triangles ? " (mismatch)" : "") << std::endl;
+  }
+
+  // Span space index built once, queried for several iso-values.
+  const SP::SpanSpaceIndex<T> index(SP::BrickMinMax<T>(volume, num_threads));
+  for (const T iso_alpha : {-0.08, 0., 0.1}) {
+    SP::PolygonizeOptions options;
+    options.num_threads = num_threads;
+
+    const auto start = std::chrono::steady_clock::now();
+    const auto mesh = SP::polygonizeVolume(volume, index, iso_alpha, options);
+    const auto end = std::chrono::steady_clock::now();
+
+    const double seconds = std::chrono::duration<double>(end - start).count();
+    std::cout << "span space, iso " << iso_alpha << ", " << num_threads << " thread(s): " << cells / seconds
+              << " cells/s (" << mesh.numTriangles() << " triangles, " << seconds << " s)" << std::endl;
+  }
+
+  // Same field quantized to 16 bits, polygonized without converting it back.
+  {
+    std::vector<uint16_t> quantized(field.size());
+    for (size_t node = 0; node < field.size(); ++node)
+      quantized[node] = static_cast<uint16_t>((field[node] + 0.09) * 40000 + 0.5);
+    const SP::ScalarVolume<T, uint16_t> volume_16(quantized.data(), SP::Vec3<int>(n, n, n), SP::Vec3<T>(0, 0, 0),
+                                                  SP::Vec3<T>(dx, dx, dx));
+    SP::PolygonizeOptions options;
+    options.num_threads = num_threads;
+
+    const auto start = std::chrono::steady_clock::now();
+    const auto mesh = SP::polygonizeVolume(volume_16, static_cast<T>(0.09 * 40000), options);
+    const auto end = std::chrono::steady_clock::now();
+
+    const double seconds = std::chrono::duration<double>(end - start).count();
+    std::cout << "uint16_t, " << num_threads << " thread(s): " << cells / seconds << " cells/s ("
+              << mesh.numTriangles() << " triangles, " << seconds << " s)" << std::endl;
+  }
+
+  // Same sphere as an implicit function, sampled while marching instead of stored.
+  {
+    SP::PolygonizeOptions options;
+    options.num_threads = num_threads;
+    const auto sphere = [](const T x, const T y, const T z) {
+      return (x - 0.5f) * (x - 0.5f) + (y - 0.5f) * (y - 0.5f) + (z - 0.5f) * (z - 0.5f) - 0.09f;
+    };
+
+    const auto start = std::chrono::steady_clock::now();
+    const auto mesh = SP::polygonizeFunction(sphere, SP::Vec3<int>(n, n, n), SP::Vec3<T>(0, 0, 0),
+                                             SP::Vec3<T>(dx, dx, dx), static_cast<T>(0.), options);
+    const auto end = std::chrono::steady_clock::now();
+
+    const double seconds = std::chrono::duration<double>(end - start).count();
+    std::cout << "function, " << num_threads << " thread(s): " << cells / seconds << " cells/s ("
+              << mesh.numTriangles() << " triangles, " << seconds << " s)" << std::endl;
+  }
+
+  return 0;
+}
@@ -31,33 +31,95 @@
 
 #include "array.h"
 #include "mat3.h"
+#include "scalar_polygonization/parallel.h"
+
+#include <stdint.h>
+#include <sys/mman.h>
+
+#include <algorithm>
+#include <new>
+#include <type_traits>
+
+namespace
+{
+constexpr std::size_t HUGE_PAGE_SIZE = std::size_t(2) << 20;
+
+std::size_t greatestCommonDivisor(std::size_t a, std::size_t b)
+{
+  while (b) {
+    const std::size_t r = a % b;
+    a = b;
+    b = r;
+  }
+  return a;
+}
+
+}  // namespace
 
 template <typename T_GRID, typename T_ARRAY>
-EXAMPLES::Array<T_GRID, T_ARRAY>::Array(const EXAMPLES::Grid<typename T_GRID::value_type, T_GRID::dim>& grid)
+EXAMPLES::Array<T_GRID, T_ARRAY>::Array(const EXAMPLES::Grid<typename T_GRID::value_type, T_GRID::dim>& grid,
+                                        const unsigned num_threads, const bool huge_pages)
     : m_grid(grid),
       m_nx(grid.numCells()[0]),
       m_ny(grid.numCells()[1]),
       m_nz(grid.numCells()[2]),
-      m_pad(grid.getPadding())
+      m_pad(grid.getPadding()),
+      m_mapping(nullptr),
+      m_mapping_size(0),
+      m_data(nullptr)
 {
-  m_data.resize(m_grid.size());
+  for (int axis = 0; axis < 3; ++axis) m_mask[axis] = grid.getMask()[axis];
 
-  for (int i = 0; i < m_data.size(); ++i) {
-    m_data[i] = T_ARRAY();
-  }
+  // Rows are padded to a whole number of `ALIGNMENT` bytes, and start `m_offset` values into the storage so that
+  // node (0, j, k) of every row is aligned.
+  const std::size_t row_align = ALIGNMENT / greatestCommonDivisor(ALIGNMENT, sizeof(T_ARRAY));
+  const std::size_t row_size = m_nx + 2 * m_pad;
+  m_row_stride = (row_size + row_align - 1) / row_align * row_align;
+  m_plane_stride = m_row_stride * (m_ny + 2 * m_pad * m_mask[1]);
+  m_offset = (row_align - m_pad % row_align) % row_align;
+
+  const std::size_t num_planes = m_nz + 2 * m_pad * m_mask[2];
+  m_size = m_offset + num_planes * m_plane_stride;
+
+  // Anonymous pages are only backed by memory when first written, by the thread initializing them.
+  const std::size_t alignment = huge_pages ? HUGE_PAGE_SIZE : ALIGNMENT;
+  m_mapping_size = m_size * sizeof(T_ARRAY) + alignment;
+  m_mapping = mmap(nullptr, m_mapping_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (m_mapping == MAP_FAILED) throw std::bad_alloc();
+
+  const uintptr_t address = reinterpret_cast<uintptr_t>(m_mapping);
+  void* storage = reinterpret_cast<void*>((address + alignment - 1) / alignment * alignment);
+#if defined(MADV_HUGEPAGE)
+  if (huge_pages) madvise(storage, m_size * sizeof(T_ARRAY), MADV_HUGEPAGE);
+#endif
+  m_data = static_cast<T_ARRAY*>(storage);
+
+  // Interior planes are split into slabs as by `forEachNodeRow`, ghost planes go with the first and last slabs.
+  const std::size_t ghost_planes = m_pad * m_mask[2];
+  const std::size_t num_slabs = SCALAR_POLYGONIZATION::numSlabs(m_nz, num_threads);
+  SCALAR_POLYGONIZATION::parallelForStatic(num_slabs, num_threads, [&](const std::size_t s) {
+    const std::size_t k_begin = s ? ghost_planes + SCALAR_POLYGONIZATION::slabBegin(m_nz, num_slabs, s) : 0;
+    const std::size_t k_end =
+        s + 1 < num_slabs ? ghost_planes + SCALAR_POLYGONIZATION::slabBegin(m_nz, num_slabs, s + 1) : num_planes;
+    const std::size_t begin = k_begin ? m_offset + k_begin * m_plane_stride : 0;
+    const std::size_t end = m_offset + k_end * m_plane_stride;
+    for (std::size_t i = begin; i < end; ++i) new (&m_data[i]) T_ARRAY();
+  });
 }
 
 template <typename T_GRID, typename T_ARRAY>
 EXAMPLES::Array<T_GRID, T_ARRAY>::~Array()
 {
-  m_data.clear();
-  m_data.shrink_to_fit();
+  if (!std::is_trivially_destructible<T_ARRAY>::value)
+    for (std::size_t i = 0; i < m_size; ++i) m_data[i].~T_ARRAY();
+
+  munmap(m_mapping, m_mapping_size);
 }
 
 template <typename T_GRID, typename T_ARRAY>
 const std::size_t EXAMPLES::Array<T_GRID, T_ARRAY>::size() const
 {
-  return m_data.size();
+  return m_size;
 }
 
 template <typename T_GRID, typename T_ARRAY>
@@ -87,33 +149,31 @@ T_ARRAY& EXAMPLES::Array<T_GRID, T_ARRAY>::operator[](const std::size_t idx)
 template <typename T_GRID, typename T_ARRAY>
 const T_ARRAY& EXAMPLES::Array<T_GRID, T_ARRAY>::operator()(const int i, const int j, const int k) const
 {
-  const std::size_t idx = m_grid.index(i, j, k);
-  return m_data[idx];
+  return m_data[this->index(i, j, k)];
 }
 
 template <typename T_GRID, typename T_ARRAY>
 T_ARRAY& EXAMPLES::Array<T_GRID, T_ARRAY>::operator()(const int i, const int j, const int k)
 {
-  const std::size_t idx = m_grid.index(i, j, k);
-  return m_data[idx];
+  return m_data[this->index(i, j, k)];
 }
 
 template <typename T_GRID, typename T_ARRAY>
 const T_ARRAY& EXAMPLES::Array<T_GRID, T_ARRAY>::operator()(const SCALAR_POLYGONIZATION::Vec3<int> node_id) const
 {
-  return m_data[m_grid.index(node_id)];
+  return m_data[this->index(node_id[0], node_id[1], node_id[2])];
 }
 
 template <typename T_GRID, typename T_ARRAY>
 T_ARRAY& EXAMPLES::Array<T_GRID, T_ARRAY>::operator()(const SCALAR_POLYGONIZATION::Vec3<int> node_id)
 {
-  return m_data[m_grid.index(node_id)];
+  return m_data[this->index(node_id[0], node_id[1], node_id[2])];
 }
 
 template <typename T_GRID, typename T_ARRAY>
 void EXAMPLES::Array<T_GRID, T_ARRAY>::operator=(const EXAMPLES::Array<T_GRID, T_ARRAY>& array)
 {
-  m_data = array.data();
+  std::copy(array.data(), array.data() + m_size, m_data);
 }
 
 template class EXAMPLES::Array<EXAMPLES::Grid<float, 3>, float>;
@@ -42,6 +42,13 @@ namespace EXAMPLES
 /*! \class Array
  *
  * Class to create Array.
+ *
+ * Values are stored in an anonymous memory mapping, 64-byte aligned, with rows along x padded to a multiple of 64
+ * bytes and node (0, j, k) of every row starting on a 64-byte boundary. Pages are not touched by the allocation:
+ * values are initialized by `num_threads` threads, each on a fixed contiguous range of planes along z, so that on a
+ * multi-socket machine each plane lands in the memory of the socket of the thread that first wrote it. Ranges are
+ * those of `forEachNodeRow` with the same number of threads, whose threads then read local memory as long as the
+ * system does not move them to another socket (threads are not pinned).
  */
 template <typename T_GRID, typename T_ARRAY>
 class Array
@@ -49,11 +56,19 @@ class Array
  public:
   using value_type = T_ARRAY;
 
+  //! Alignment, in bytes, of storage and of rows.
+  static constexpr std::size_t ALIGNMENT = 64;
+
   /*! Constructor called using grid.
    *
    * \param grid object of Grid.
+   * \param num_threads number of threads initializing values, 0 for all hardware threads.
+   * \param huge_pages whether to align storage to 2 MiB and advise transparent huge pages.
    */
-  Array(const Grid<typename T_GRID::value_type, T_GRID::dim> &grid);
+  Array(const Grid<typename T_GRID::value_type, T_GRID::dim> &grid, const unsigned num_threads = 1,
+        const bool huge_pages = false);
+
+  Array(const Array<T_GRID, T_ARRAY> &) = delete;
 
   /*! Destructor
    */
@@ -61,12 +76,26 @@ class Array
 
   /*! Returns 1D array size of array.
    *
-   * Data of array is stored in 1D vector with some padding. This function returns 1D vector size.
+   * Data of array is stored in 1D array with ghost nodes and padding. This function returns 1D array size.
    *
    * \return 1D array size.
    */
   const std::size_t size() const;
 
+  /*! Returns 1D index in stored array.
+   *
+   * \param i zero based index along x-direction.
+   * \param j zero based index along y-direction.
+   * \param k zero based index along z-direction.
+   *
+   * \return 1D index.
+   */
+  const std::size_t index(const int i, const int j, const int k) const
+  {
+    return m_offset + static_cast<std::size_t>(k + m_pad * m_mask[2]) * m_plane_stride +
+           static_cast<std::size_t>(j + m_pad * m_mask[1]) * m_row_stride + static_cast<std::size_t>(i + m_pad);
+  }
+
   /*! Returns attached grid.
    */
   const T_GRID &grid() const;
@@ -81,9 +110,9 @@ class Array
 
   /*! Get data.
    *
-   * \return vector that stores data.
+   * \return pointer to the stored array, of `size()` values.
    */
-  const std::vector<T_ARRAY> &data() const { return m_data; }
+  const T_ARRAY *data() const { return m_data; }
 
   /*! Overloaded subscript operator to return value of array at a given 1D array based index.
    *
@@ -139,7 +168,7 @@ class Array
 
   /*! Overloaded operator to assign values.
    *
-   * \param array array from which values will be copied.
+   * \param array array on the same grid from which values will be copied.
    */
   void operator=(const Array<T_GRID, T_ARRAY> &array);
 
@@ -165,7 +194,14 @@ class Array
  private:
   const T_GRID &m_grid;
   const int m_nx, m_ny, m_nz, m_pad;
-  std::vector<T_ARRAY> m_data;
+  int m_mask[3];
+  std::size_t m_row_stride;    //!< Distance between consecutive rows along y, padded.
+  std::size_t m_plane_stride;  //!< Distance between consecutive planes along z.
+  std::size_t m_offset;        //!< Index of node (-pad, -pad, -pad), aligning node (0, j, k).
+  std::size_t m_size;          //!< Number of stored values.
+  void *m_mapping;             //!< Anonymous mapping holding the values.
+  std::size_t m_mapping_size;  //!< Size of the mapping in bytes.
+  T_ARRAY *m_data;             //!< Stored values.
 };
 
 }  // namespace EXAMPLES
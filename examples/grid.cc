@@ -66,14 +66,18 @@ EXAMPLES::Grid<T, DIM>::Grid(int nx) : Grid(nx, 1, 1)
 template <typename T, int DIM>
 EXAMPLES::Grid<T, DIM>::~Grid()
 {
-  m_grid.clear();
-  m_grid.shrink_to_fit();
 }
 
 template <typename T, int DIM>
-SCALAR_POLYGONIZATION::Vec3<T>& EXAMPLES::Grid<T, DIM>::x(const int i, const int j, const int k)
+const SCALAR_POLYGONIZATION::Vec3<T> EXAMPLES::Grid<T, DIM>::x(const int i, const int j, const int k) const
 {
-  return m_grid[this->index(i, j, k)];
+  // Index of the node from the first stored node, (-pad, -pad, -pad) along grid dimensions.
+  const int node_id[3] = {i + m_pad * m_mask[0], j + m_pad * m_mask[1], k + m_pad * m_mask[2]};
+
+  SCALAR_POLYGONIZATION::Vec3<T> position;
+  for (int axis = 0; axis < DIM; ++axis) position[axis] = m_origin[axis] + node_id[axis] * m_dx[axis];
+
+  return position;
 }
 
 template <typename T, int DIM>
@@ -85,7 +89,7 @@ const int EXAMPLES::Grid<T, DIM>::dimension() const
 template <typename T, int DIM>
 const int EXAMPLES::Grid<T, DIM>::size() const
 {
-  return m_grid.size();
+  return (m_nz + 2 * m_pad * m_mask[2]) * (m_ny + 2 * m_pad * m_mask[1]) * (m_nx + 2 * m_pad * m_mask[0]);
 }
 
 template <typename T, int DIM>
@@ -153,16 +157,16 @@ const SCALAR_POLYGONIZATION::Vec3<T>& EXAMPLES::Grid<T, DIM>::oneOverDX() const
 }
 
 template <typename T, int DIM>
-const SCALAR_POLYGONIZATION::Vec3<T>& EXAMPLES::Grid<T, DIM>::operator()(const int i, const int j, const int k) const
+const SCALAR_POLYGONIZATION::Vec3<T> EXAMPLES::Grid<T, DIM>::operator()(const int i, const int j, const int k) const
 {
-  return m_grid[this->index(i, j, k)];
+  return this->x(i, j, k);
 }
 
 template <typename T, int DIM>
-const SCALAR_POLYGONIZATION::Vec3<T>& EXAMPLES::Grid<T, DIM>::operator()(
+const SCALAR_POLYGONIZATION::Vec3<T> EXAMPLES::Grid<T, DIM>::operator()(
     const SCALAR_POLYGONIZATION::Vec3<int> node_id) const
 {
-  return m_grid[this->index(node_id)];
+  return this->x(node_id[0], node_id[1], node_id[2]);
 }
 
 template <typename T, int DIM>
@@ -174,14 +178,10 @@ void EXAMPLES::Grid<T, DIM>::setPadding(const int pad)
 template <typename T, int DIM>
 void EXAMPLES::Grid<T, DIM>::generate(T x_min, T x_max, T y_min, T y_max, T z_min, T z_max)
 {
-  if (m_grid.size()) m_grid.clear(), m_grid.shrink_to_fit();
-
   m_box_min[0] = x_min, m_box_min[1] = y_min, m_box_min[2] = z_min;
   m_box_max[0] = x_max, m_box_max[1] = y_max, m_box_max[2] = z_max;
 
-  m_grid.resize((m_nz + 2 * m_pad * m_mask[2]) * (m_ny + 2 * m_pad * m_mask[1]) * (m_nx + 2 * m_pad * m_mask[0]));
-
-  std::vector<T> domain_min({x_min, y_min, z_min}), domain_min_new(3);
+  std::vector<T> domain_min({x_min, y_min, z_min});
 
   m_dx[0] = (x_max - x_min) / m_nx;
   m_dx[1] = (y_max - y_min) / m_ny;
@@ -189,27 +189,7 @@ void EXAMPLES::Grid<T, DIM>::generate(T x_min, T x_max, T y_min, T y_max, T z_mi
 
   for (int i = 0; i < DIM; ++i) m_one_over_dx[i] = static_cast<T>(1.) / m_dx[i];
 
-  for (int i = 0; i < DIM; ++i) domain_min_new[i] = domain_min[i] + (m_dx[i] * 0.5) - (m_dx[i] * m_mask[i]);
-
-  SCALAR_POLYGONIZATION::Vec3<T> elem;
-
-  int i_min = -m_pad * m_mask[0], j_min = -m_pad * m_mask[1], k_min = -m_pad * m_mask[2];
-
-  SCALAR_POLYGONIZATION::Vec3<int> vec;
-
-  for (int i = i_min; i < m_nx + m_pad * m_mask[0]; ++i) {
-    for (int j = j_min; j < m_ny + m_pad * m_mask[1]; ++j) {
-      for (int k = k_min; k < m_nz + m_pad * m_mask[2]; ++k) {
-        vec[0] = i - i_min;
-        vec[1] = j - j_min;
-        vec[2] = k - k_min;
-
-        for (int axis = 0; axis < DIM; ++axis) elem[axis] = domain_min_new[axis] + vec[axis] * m_dx[axis];
-
-        this->x(i, j, k) = elem;
-      }
-    }
-  }
+  for (int i = 0; i < DIM; ++i) m_origin[i] = domain_min[i] + (m_dx[i] * 0.5) - (m_dx[i] * m_mask[i]);
 
   // Update total cells.
   m_total_cells = 1;
@@ -43,6 +43,8 @@ namespace EXAMPLES
 /*! \class Grid
  *
  * Class to create grid.
+ *
+ * Nodes are uniformly spaced, so their positions are computed from their indices instead of being stored.
  */
 template <typename T, int DIM = 3>
 class Grid
@@ -95,7 +97,7 @@ class Grid
    *
    * \return 3D position vector.
    */
-  SCALAR_POLYGONIZATION::Vec3<T>& x(const int i, const int j = 0, const int k = 0);
+  const SCALAR_POLYGONIZATION::Vec3<T> x(const int i, const int j = 0, const int k = 0) const;
 
   /*! Returns dimension of grid.
    *
@@ -186,7 +188,7 @@ class Grid
    *
    * \return position.
    */
-  const SCALAR_POLYGONIZATION::Vec3<T>& operator()(const int i, const int j, const int k) const;
+  const SCALAR_POLYGONIZATION::Vec3<T> operator()(const int i, const int j, const int k) const;
 
   /*! Operator overloaded to return co-ordinate values at a given 3D index.
    *
@@ -194,7 +196,7 @@ class Grid
    *
    * \return position.
    */
-  const SCALAR_POLYGONIZATION::Vec3<T>& operator()(const SCALAR_POLYGONIZATION::Vec3<int> node_id) const;
+  const SCALAR_POLYGONIZATION::Vec3<T> operator()(const SCALAR_POLYGONIZATION::Vec3<int> node_id) const;
 
   /*! Set new padding value.
    *
@@ -225,7 +227,7 @@ class Grid
   int m_mask[3];
   SCALAR_POLYGONIZATION::Vec3<T> m_box_min, m_box_max;
   SCALAR_POLYGONIZATION::Vec3<T> m_dx, m_one_over_dx;
-  std::vector<SCALAR_POLYGONIZATION::Vec3<T>> m_grid;
+  SCALAR_POLYGONIZATION::Vec3<T> m_origin;  //!< position of the first stored node.
 };
 
 template <typename T, int DIM>
@@ -41,7 +41,6 @@ int main()
 
   rd.createGrid(0, 1, 0, 1, 0, 1);
   rd.createScalarField(ScalarObject::CIRCLE);
-  rd.computeNormals();
 
   rd.polygonize(0.);
   rd.writeToObj("smooth-circle.obj");
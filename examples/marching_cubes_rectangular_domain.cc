@@ -30,10 +30,14 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include "marching_cubes_rectangular_domain.h"
+#include "stencil.h"
+#include "scalar_polygonization/edge_index_cache.h"
+#include "scalar_polygonization/mesh_io.h"
 #include "scalar_polygonization/tables.h"
 
-#include <assert.h>
-#include <fstream>
+#include <array>
+#include <limits>
+#include <stdexcept>
 
 using namespace EXAMPLES;
 
@@ -48,18 +52,17 @@ MarchingCubesRectangularDomain::~MarchingCubesRectangularDomain()
   if (m_normal_vector_field) delete m_normal_vector_field;
 }
 
-void MarchingCubesRectangularDomain::createGrid(T x_min, T x_max, T y_min, T y_max, T z_min, T z_max)
+void MarchingCubesRectangularDomain::createGrid(T x_min, T x_max, T y_min, T y_max, T z_min, T z_max,
+                                                const unsigned num_threads)
 {
   m_grid.generate(x_min, x_max, y_min, y_max, z_min, z_max);
 
-  m_scalar_field = new Array<Grid<T, 3>, T>(m_grid);
-  m_normal_vector_field = new Array<Grid<T, 3>, SCALAR_POLYGONIZATION::Vec3<T>>(m_grid);
+  m_scalar_field = new Array<Grid<T, 3>, T>(m_grid, num_threads);
 }
 
 void MarchingCubesRectangularDomain::createScalarField(ScalarObject object)
 {
   auto &scalar_field = *m_scalar_field;
-  auto &normals = *m_normal_vector_field;
 
   // accessing grid details
   const auto mask = m_grid.getMask();
@@ -89,9 +92,6 @@ void MarchingCubesRectangularDomain::createScalarField(ScalarObject object)
             scalar_field(i, j, k) = dist - radius * radius;
             // scalar_field(i, j, k) = static_cast<T>(0.);
             // if (dist <= radius * radius) scalar_field(i, j, k) = static_cast<T>(1.);
-
-            // Initialize normals to zero vector.
-            normals(i, j, k) = SCALAR_POLYGONIZATION::Vec3<T>(0., 0., 0.);
           }
       break;
     }
@@ -105,9 +105,6 @@ void MarchingCubesRectangularDomain::createScalarField(ScalarObject object)
             scalar_field(i, j, k) = static_cast<T>(0.);
             if (m_grid(i, j, k)[0] <= x_w && m_grid(i, j, k)[1] <= y_w && m_grid(i, j, k)[2] <= z_w)
               scalar_field(i, j, k) = static_cast<T>(1.);
-
-            // Initialize normals to zero vector.
-            normals(i, j, k) = SCALAR_POLYGONIZATION::Vec3<T>(0., 0., 0.);
           }
 
       break;
@@ -118,68 +115,52 @@ void MarchingCubesRectangularDomain::createScalarField(ScalarObject object)
   }
 }
 
-void MarchingCubesRectangularDomain::computeNormals()
+void MarchingCubesRectangularDomain::computeNormals(const unsigned num_threads)
 {
-  auto &scalar_field = *m_scalar_field;
-  auto &normals = *m_normal_vector_field;
+  // Normals of ghost nodes are left zero.
+  if (!m_normal_vector_field)
+    m_normal_vector_field = new Array<Grid<T, 3>, SCALAR_POLYGONIZATION::Vec3<T>>(m_grid, num_threads);
 
-  using T_GRID = decltype(m_grid);
-  const auto dim = T_GRID::dim;
-
-  const auto num_cells = m_grid.numCells();
-  const auto dx = m_grid.dX();
-  const auto &axis_vectors = T_GRID::axis_vectors;
-
-  for (int i = 0; i < num_cells[0]; ++i)
-    for (int j = 0; j < num_cells[1]; ++j)
-      for (int k = 0; k < num_cells[2]; ++k) {
-        for (int cmpt = 0; cmpt < dim; ++cmpt) {
-          typename T_GRID::value_type one_by_dx = static_cast<typename T_GRID::value_type>(1.) / dx[cmpt];
-
-          normals(i, j, k)[cmpt] =
-              (scalar_field(i + axis_vectors(cmpt, 0), j + axis_vectors(cmpt, 1), k + axis_vectors(cmpt, 2)) -
-               scalar_field(i - axis_vectors(cmpt, 0), j - axis_vectors(cmpt, 1), k - axis_vectors(cmpt, 2))) *
-              one_by_dx * static_cast<T>(0.5);
-
-          // NOTE: This sign change is not needed if Convention-2 is followed and the scalar field enclosing
-          // the surface is higher than the iso-surface value.
-          normals(i, j, k)[cmpt] *= static_cast<T>(-1.);
-        }
-      }
+  // NOTE: The sign change is not needed if Convention-2 is followed and the scalar field enclosing the surface is
+  // higher than the iso-surface value.
+  computeGradient(*m_scalar_field, *m_normal_vector_field, static_cast<T>(-1.), num_threads);
 }
 
-void MarchingCubesRectangularDomain::computeVertexNormalsFromTriangles()
+SCALAR_POLYGONIZATION::Vec3<MarchingCubesRectangularDomain::T> MarchingCubesRectangularDomain::nodeNormal(
+    const int i, const int j, const int k) const
 {
-  // Set normals at all surface vertices to zero.
-  for (auto &surface_triangle : surface_triangles) {
-    for (auto i = 0; i < 3; ++i) {
-      const auto &vertex_id = surface_triangle.vertex_ids[i];
-      surface_vertices[vertex_id].normal = SCALAR_POLYGONIZATION::Vec3<T>(0., 0., 0.);
-      surface_vertices[vertex_id].num_shared_triangles = static_cast<unsigned>(0);
-    }
-  }
+  const auto &scalar_field = *m_scalar_field;
+  const auto num_cells = m_grid.numCells();
+  const auto dx = m_grid.dX();
 
-  // Average triangle normals to vertex normals.
-  for (auto &surface_triangle : surface_triangles) {
-    for (auto i = 0; i < 3; ++i) {
-      const auto &vertex_id = surface_triangle.vertex_ids[i];
-      surface_vertices[vertex_id].normal = surface_vertices[vertex_id].normal + surface_triangle.normal;
-      ++surface_vertices[vertex_id].num_shared_triangles;
-    }
+  SCALAR_POLYGONIZATION::Vec3<T> normal(0., 0., 0.);
+  if (i < 0 || j < 0 || k < 0 || i >= num_cells[0] || j >= num_cells[1] || k >= num_cells[2]) return normal;
+
+  // Same expression as `computeGradient` in `computeNormals`, so both give identical normals.
+  const int node[3] = {i, j, k};
+  for (int cmpt = 0; cmpt < 3; ++cmpt) {
+    int plus[3] = {i, j, k}, minus[3] = {i, j, k};
+    plus[cmpt] = node[cmpt] + 1;
+    minus[cmpt] = node[cmpt] - 1;
+    const T one_by_dx = static_cast<T>(1.) / dx[cmpt];
+    normal[cmpt] = -((scalar_field(plus[0], plus[1], plus[2]) - scalar_field(minus[0], minus[1], minus[2])) *
+                     one_by_dx * static_cast<T>(0.5));
   }
 
-  for (auto &surface_vertex : surface_vertices) {
-    auto &vertex = surface_vertex.second;
-    for (int i = 0; i < 3; ++i) vertex.normal[i] /= vertex.num_shared_triangles;
+  return normal;
+}
 
-    vertex.normal.normalize();
-  }
+void MarchingCubesRectangularDomain::computeVertexNormalsFromTriangles(const unsigned num_threads)
+{
+  SCALAR_POLYGONIZATION::computeVertexNormals(surface_mesh, SCALAR_POLYGONIZATION::NormalWeighting::AREA, num_threads);
 }
 
-void MarchingCubesRectangularDomain::polygonize(const T iso_alpha)
+void MarchingCubesRectangularDomain::polygonize(const T iso_alpha, const unsigned num_threads)
 {
   auto &scalar_field = *m_scalar_field;
-  auto &normal_vector_field = *m_normal_vector_field;
+
+  // Without a normal field, gradients are computed at the nodes of intersected edges only.
+  const auto *normal_vector_field = m_normal_vector_field;
 
   // accessing grid details
   const auto mask = m_grid.getMask();
@@ -194,106 +175,114 @@ void MarchingCubesRectangularDomain::polygonize(const T iso_alpha)
   int j_max = num_cells[1] + pad * mask[1];
   int k_max = num_cells[2] + pad * mask[2];
 
-  SCALAR_POLYGONIZATION::MarchingCubes<T> mc;
-
-  std::vector<SCALAR_POLYGONIZATION::Vec3<int>> vertex_indices(8);
-  std::vector<size_t> vertex_ids(8);
-  std::vector<SCALAR_POLYGONIZATION::Vec3<T>> cube_vertices(8);
-  std::vector<size_t> edge_ids(12);
-  std::vector<T> scalars(8);
-  std::vector<SCALAR_POLYGONIZATION::Vec3<T>> normals(8);
-  size_t triangle_start_id = 0;
+  // Cube vertices are gathered in the order of `Convention`, e.g. Convention2 for the ordering of Paul Bourke.
+  using Convention = SCALAR_POLYGONIZATION::Convention1;
+  SCALAR_POLYGONIZATION::MarchingCubes<T, Convention> mc;
+
+  // Positions are not gathered: marching cubes runs on a unit cube, and positions of new surface vertices are computed
+  // from node indices of their edge.
+  SCALAR_POLYGONIZATION::Vec3<int> vertex_index;
+  std::array<SCALAR_POLYGONIZATION::Vec3<T>, 8> unit_cube;
+  for (int v_idx = 0; v_idx < 8; ++v_idx)
+    unit_cube[v_idx] = SCALAR_POLYGONIZATION::Vec3<T>(
+        Convention::vertexOffset(v_idx, 0), Convention::vertexOffset(v_idx, 1), Convention::vertexOffset(v_idx, 2));
+  std::array<T, 8> scalars;
+  std::array<SCALAR_POLYGONIZATION::Vec3<T>, 8> normals;
+  SCALAR_POLYGONIZATION::CubeTriangulation<T> triangulation;
+
+  // Surface vertices are welded through indices stored on edges of two node planes (along z) at a time. Stored indices
+  // are relative to the first vertex of the previous layer, so they fit in 32 bits for any index type `I`.
+  SCALAR_POLYGONIZATION::EdgeIndexCache edge_to_vertex(i_max - i_min, j_max - j_min, Convention());
+  const int nx = i_max - i_min, ny = j_max - j_min;
+  I base = 0, layer_begin = 0;
+
+  surface_mesh.clear();
+
+  for (int k = k_min; k < k_max - 1; ++k) {
+    if (k > k_min) {
+      edge_to_vertex.advance();
+
+      // Vertices kept on the bottom plane were created by the previous layer, move their base to its first vertex.
+      const auto shift = static_cast<uint32_t>(layer_begin - base);
+      for (int j = 0; j < ny; ++j)
+        for (int i = 0; i < nx; ++i)
+          for (int axis = 0; axis < 2; ++axis) {
+            auto &vertex_id = edge_to_vertex.edge(axis, i, j, false);
+            if (vertex_id != SCALAR_POLYGONIZATION::EdgeIndexCache::INVALID) vertex_id -= shift;
+          }
+      base = layer_begin;
+    }
+    layer_begin = static_cast<I>(surface_mesh.numVertices());
 
-  for (int i = i_min; i < i_max - 1; ++i)
     for (int j = j_min; j < j_max - 1; ++j)
-      for (int k = k_min; k < k_max - 1; ++k) {
-        // ------ Convention-2 (Ref.: http://paulbourke.net/geometry/polygonise/)
-        // vertex_indices[0] = SCALAR_POLYGONIZATION::Vec3<int>(i, j, k);
-        // vertex_indices[1] = SCALAR_POLYGONIZATION::Vec3<int>(i + 1, j, k);
-        // vertex_indices[2] = SCALAR_POLYGONIZATION::Vec3<int>(i + 1, j, k + 1);
-        // vertex_indices[3] = SCALAR_POLYGONIZATION::Vec3<int>(i, j, k + 1);
-        // vertex_indices[4] = SCALAR_POLYGONIZATION::Vec3<int>(i, j + 1, k);
-        // vertex_indices[5] = SCALAR_POLYGONIZATION::Vec3<int>(i + 1, j + 1, k);
-        // vertex_indices[6] = SCALAR_POLYGONIZATION::Vec3<int>(i + 1, j + 1, k + 1);
-        // vertex_indices[7] = SCALAR_POLYGONIZATION::Vec3<int>(i, j + 1, k + 1);
-        //--------------------
-
+      for (int i = i_min; i < i_max - 1; ++i) {
         for (int v_idx = 0; v_idx < 8; ++v_idx) {
-          // ------ Convention-1
-          vertex_indices[v_idx] = SCALAR_POLYGONIZATION::Vec3<int>(i, j, k) +
-                                  SCALAR_POLYGONIZATION::Vec3<int>(SCALAR_POLYGONIZATION::vertex_offset[v_idx][0],
-                                                                   SCALAR_POLYGONIZATION::vertex_offset[v_idx][1],
-                                                                   SCALAR_POLYGONIZATION::vertex_offset[v_idx][2]);
-          //--------------------
-          vertex_ids[v_idx] = m_grid.index(vertex_indices[v_idx]);
-          cube_vertices[v_idx] = m_grid(vertex_indices[v_idx]);
-          scalars[v_idx] = scalar_field(vertex_indices[v_idx]);
-          normals[v_idx] = normal_vector_field(vertex_indices[v_idx]);
+          vertex_index[0] = i + Convention::vertexOffset(v_idx, 0);
+          vertex_index[1] = j + Convention::vertexOffset(v_idx, 1);
+          vertex_index[2] = k + Convention::vertexOffset(v_idx, 2);
+          scalars[v_idx] = scalar_field(vertex_index);
+          if (normal_vector_field) normals[v_idx] = (*normal_vector_field)(vertex_index);
         }
 
-        // Get edge_ids from vertex_ids.
-        edge_ids = mc.vertexToEdgeIds(m_grid.size(), vertex_ids);
-
         // Run marching cubes algorithm.
-        const auto triangle_vertex_tuple = mc.marchCube(cube_vertices, edge_ids, scalars, normals, iso_alpha);
-
-        std::vector<SCALAR_POLYGONIZATION::Triangle<T>> triangles =
-            std::get<SCALAR_POLYGONIZATION::TRIANGLES>(triangle_vertex_tuple);
-        std::vector<SCALAR_POLYGONIZATION::Vertex<T>> triangle_vertices =
-            std::get<SCALAR_POLYGONIZATION::VERTICES>(triangle_vertex_tuple);
-
-        triangle_start_id += triangles.size();
-
-        for (auto &triangle : triangles) surface_triangles.push_back(std::move(triangle));
+        if (!mc.marchCube(unit_cube.data(), scalars.data(), normal_vector_field ? normals.data() : nullptr,
+                          iso_alpha, triangulation))
+          continue;
+
+        // Create surface vertices on edges not visited by a neighbouring cube.
+        std::array<I, SCALAR_POLYGONIZATION::CubeTriangulation<T>::MAX_VERTICES> slot_to_vertex;
+        for (int slot = 0; slot < triangulation.num_vertices; ++slot) {
+          auto &vertex_id = edge_to_vertex(triangulation.edges[slot], i - i_min, j - j_min);
+          if (vertex_id == SCALAR_POLYGONIZATION::EdgeIndexCache::INVALID) {
+            // Vertex counts fit in `I`, indices stored on edges are relative to `base` in 32 bits.
+            if (surface_mesh.numVertices() >= std::numeric_limits<I>::max())
+              throw std::overflow_error("too many vertices for the index type");
+            if (surface_mesh.numVertices() - base >= SCALAR_POLYGONIZATION::EdgeIndexCache::INVALID)
+              throw std::overflow_error("too many vertices in two layers of cubes");
+            vertex_id = static_cast<uint32_t>(surface_mesh.numVertices() - base);
+
+            // Interpolate between the two nodes of the edge as `marchCube` does with gathered cube vertices.
+            const int edge = triangulation.edges[slot];
+            const int v0 = Convention::edgeVertex(edge, 0), v1 = Convention::edgeVertex(edge, 1);
+            const int i0 = i + Convention::vertexOffset(v0, 0), j0 = j + Convention::vertexOffset(v0, 1),
+                      k0 = k + Convention::vertexOffset(v0, 2);
+            const int i1 = i + Convention::vertexOffset(v1, 0), j1 = j + Convention::vertexOffset(v1, 1),
+                      k1 = k + Convention::vertexOffset(v1, 2);
+            const T frac = triangulation.weights[slot];
+            const T one_minus_frac = static_cast<T>(1.) - frac;
+
+            const auto p0 = m_grid(i0, j0, k0), p1 = m_grid(i1, j1, k1);
+            SCALAR_POLYGONIZATION::Vec3<T> position;
+            for (int axis = 0; axis < 3; ++axis) position[axis] = p0[axis] * one_minus_frac + p1[axis] * frac;
+            surface_mesh.positions.push_back(position);
+
+            if (normal_vector_field) {
+              surface_mesh.normals.push_back(triangulation.normals[slot]);
+            } else {
+              // Gradients at the two nodes of the edge.
+              const auto n0 = this->nodeNormal(i0, j0, k0), n1 = this->nodeNormal(i1, j1, k1);
+              SCALAR_POLYGONIZATION::Vec3<T> normal;
+              for (int axis = 0; axis < 3; ++axis) normal[axis] = n0[axis] * one_minus_frac + n1[axis] * frac;
+              surface_mesh.normals.push_back(normal);
+            }
+          }
+          slot_to_vertex[slot] = base + vertex_id;
+        }
 
-        for (auto &triangle_vertex : triangle_vertices)
-          if (surface_vertices.find(triangle_vertex.id) == surface_vertices.end())
-            surface_vertices[triangle_vertex.id] = std::move(triangle_vertex);
+        for (int c = 0; c < 3 * triangulation.num_triangles; ++c)
+          surface_mesh.indices.push_back(slot_to_vertex[triangulation.triangles[c]]);
       }
+  }
 
-  assert(surface_triangles.size() == triangle_start_id);
   std::cout << "Scalar polygonization complete" << std::endl;
-  std::cout << "\tNumber of surface vertices: " << surface_vertices.size() << std::endl;
-  std::cout << "\tNumber of surface triangles: " << surface_triangles.size() << std::endl;
-
-  // Update obj_id of each surface vertex.
-  size_t obj_id = 1;
-  for (auto &surface_vertex_pair : surface_vertices) {
-    auto &surface_vertex = surface_vertex_pair.second;
-    surface_vertex.obj_id = obj_id++;
-  }
+  std::cout << "\tNumber of surface vertices: " << surface_mesh.numVertices() << std::endl;
+  std::cout << "\tNumber of surface triangles: " << surface_mesh.numTriangles() << std::endl;
 
-  // Compute normals at vertices as average of triangle normals.
-  this->computeVertexNormalsFromTriangles();
+  // Compute normals at vertices as area weighted average of triangle normals.
+  this->computeVertexNormalsFromTriangles(num_threads);
 }
 
 void MarchingCubesRectangularDomain::writeToObj(const std::string file_name)
 {
-  std::ofstream obj_file(file_name);
-
-  // Write vertex locations.
-  for (const auto &surface_vertex_pair : surface_vertices) {
-    const auto &surface_vertex = surface_vertex_pair.second;
-    obj_file << "v " << surface_vertex.pos[0] << " " << surface_vertex.pos[1] << " " << surface_vertex.pos[2]
-             << std::endl;
-  }
-
-  // Write vertex normals.
-  for (const auto &surface_vertex_pair : surface_vertices) {
-    const auto &surface_vertex = surface_vertex_pair.second;
-    obj_file << "vn " << surface_vertex.normal[0] << " " << surface_vertex.normal[1] << " " << surface_vertex.normal[2]
-             << std::endl;
-  }
-
-  // Write face data.
-  for (const auto &surface_triangle : surface_triangles) {
-    auto v_vn_0 = surface_vertices[surface_triangle.vertex_ids[0]].obj_id;
-    auto v_vn_1 = surface_vertices[surface_triangle.vertex_ids[1]].obj_id;
-    auto v_vn_2 = surface_vertices[surface_triangle.vertex_ids[2]].obj_id;
-
-    obj_file << "f " << v_vn_0 << "//" << v_vn_0 << " " << v_vn_1 << "//" << v_vn_1 << " " << v_vn_2 << "//" << v_vn_2
-             << " " << std::endl;
-  }
-
-  obj_file.close();
+  SCALAR_POLYGONIZATION::writeObj(file_name, surface_mesh);
 }
@@ -35,9 +35,11 @@
 #include "grid.h"
 #include "mat3.h"
 #include "scalar_polygonization/marching_cubes.h"
+#include "scalar_polygonization/polygonize_volume.h"
 #include "scalar_polygonization/vec3.h"
 
-#include <map>
+#include <stdint.h>
+#include <vector>
 
 namespace EXAMPLES
 {
@@ -46,28 +48,55 @@ enum class ScalarObject : int { CIRCLE, DAM };
 class MarchingCubesRectangularDomain
 {
   using T = float;
+  using I = uint32_t;  // uint64_t for surfaces of more than 2^32 vertices.
 
  public:
   MarchingCubesRectangularDomain(int nx, int ny, int nz);
 
   ~MarchingCubesRectangularDomain();
 
-  void createGrid(T x_min, T x_max, T y_min, T y_max, T z_min, T z_max);
+  /*! Generate the grid and allocate the scalar field on it.
+   *
+   * \param num_threads number of threads initializing the scalar field, use the same as for `computeNormals` so that
+   *        each thread reads the planes it placed in memory. 0 for all hardware threads.
+   */
+  void createGrid(T x_min, T x_max, T y_min, T y_max, T z_min, T z_max, const unsigned num_threads = 1);
 
   void createScalarField(ScalarObject object);
 
-  void computeNormals();
+  /*! Compute normals at all grid nodes into `m_normal_vector_field`, which `polygonize` then interpolates.
+   *
+   * Not needed by `polygonize`, which otherwise computes gradients only at the two nodes of each intersected edge.
+   *
+   * \param num_threads number of threads, 0 for all hardware threads.
+   */
+  void computeNormals(const unsigned num_threads = 1);
 
-  void computeVertexNormalsFromTriangles();
+  /*! Replace normals of `surface_mesh` by area weighted averages of the normals of its triangles.
+   *
+   * \param num_threads number of threads, 0 for all hardware threads.
+   */
+  void computeVertexNormalsFromTriangles(const unsigned num_threads = 1);
 
-  void polygonize(const T iso_alpha);
+  /*! Polygonize the scalar field into `surface_mesh`.
+   *
+   * Surfaces with more vertices than `I` can index throw `std::overflow_error`.
+   *
+   * \param iso_alpha value for which iso-surface needs to be extracted.
+   * \param num_threads number of threads computing vertex normals from triangles, 0 for all hardware threads.
+   */
+  void polygonize(const T iso_alpha, const unsigned num_threads = 1);
 
   void writeToObj(const std::string file_name);
 
+  /*! Normal at node (i, j, k) as in `computeNormals`: negative central-difference gradient of the scalar field at
+   * interior nodes, zero at ghost nodes.
+   */
+  SCALAR_POLYGONIZATION::Vec3<T> nodeNormal(const int i, const int j, const int k) const;
+
   Grid<T, 3> m_grid;                                                          //!< 3D grid.
   Array<Grid<T, 3>, T> *m_scalar_field;                                       //!< scalar field at all grid locations.
-  Array<Grid<T, 3>, SCALAR_POLYGONIZATION::Vec3<T>> *m_normal_vector_field;  //!< normal vectors at all grid locations.
-  std::map<size_t, SCALAR_POLYGONIZATION::Vertex<T>> surface_vertices;       //!< vertices forming polygonized field.
-  std::vector<SCALAR_POLYGONIZATION::Triangle<T>> surface_triangles;         //!< surface triangles.
+  Array<Grid<T, 3>, SCALAR_POLYGONIZATION::Vec3<T>> *m_normal_vector_field;  //!< normals at grid locations, or null.
+  SCALAR_POLYGONIZATION::IndexedMesh<T, I> surface_mesh;                     //!< polygonized surface.
 };
 }  // namespace EXAMPLES
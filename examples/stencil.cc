@@ -0,0 +1,159 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright 2019 Lakshman Anumolu.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///////////////////////////////////////////////////////////////////////////////
+
+#include "stencil.h"
+
+#include <math.h>
+#include <stddef.h>
+
+#include <stdexcept>
+
+namespace
+{
+/*! Strides, in number of nodes, between consecutive rows along y and planes along z of an array.
+ *
+ * Throws `std::runtime_error` unless the grid is 3D with at least one ghost node, which stencils read around
+ * interior nodes.
+ */
+template <typename T_GRID, typename T_ARRAY>
+void nodeStrides(const EXAMPLES::Array<T_GRID, T_ARRAY>& array, ptrdiff_t& row_stride,
+                 ptrdiff_t& plane_stride)
+{
+  const auto& grid = array.grid();
+  if (grid.dimension() != 3 || grid.getPadding() < 1)
+    throw std::runtime_error("stencils need a 3D grid with a padding of at least 1");
+
+  row_stride = &array(0, 1, 0) - &array(0, 0, 0);
+  plane_stride = &array(0, 0, 1) - &array(0, 0, 0);
+}
+}  // namespace
+
+template <typename T>
+void EXAMPLES::computeGradient(const Array<Grid<T, 3>, T>& field,
+                               Array<Grid<T, 3>, SCALAR_POLYGONIZATION::Vec3<T>>& gradient, const T scale,
+                               const unsigned num_threads)
+{
+  static_assert(sizeof(SCALAR_POLYGONIZATION::Vec3<T>) == 3 * sizeof(T), "Vec3 arrays are written as coordinates");
+
+  ptrdiff_t sy, sz;
+  nodeStrides(field, sy, sz);
+
+  const auto dx = field.grid().dX();
+  T one_by_dx[3];
+  for (int axis = 0; axis < 3; ++axis) one_by_dx[axis] = static_cast<T>(1.) / dx[axis];
+
+  forEachNodeRow(field.grid(), num_threads, [&](const int i_begin, const int i_end, const int j, const int k) {
+    const T* f = &field(0, j, k);
+    T* g = reinterpret_cast<T*>(&gradient(0, j, k));
+    for (int i = i_begin; i < i_end; ++i) {
+      g[3 * i] = (f[i + 1] - f[i - 1]) * one_by_dx[0] * static_cast<T>(0.5) * scale;
+      g[3 * i + 1] = (f[i + sy] - f[i - sy]) * one_by_dx[1] * static_cast<T>(0.5) * scale;
+      g[3 * i + 2] = (f[i + sz] - f[i - sz]) * one_by_dx[2] * static_cast<T>(0.5) * scale;
+    }
+  });
+}
+
+template <typename T>
+void EXAMPLES::computeLaplacian(const Array<Grid<T, 3>, T>& field, Array<Grid<T, 3>, T>& laplacian,
+                                const unsigned num_threads)
+{
+  ptrdiff_t sy, sz;
+  nodeStrides(field, sy, sz);
+
+  const auto dx = field.grid().dX();
+  T one_by_dx2[3];
+  for (int axis = 0; axis < 3; ++axis) one_by_dx2[axis] = static_cast<T>(1.) / (dx[axis] * dx[axis]);
+
+  forEachNodeRow(field.grid(), num_threads, [&](const int i_begin, const int i_end, const int j, const int k) {
+    const T* f = &field(0, j, k);
+    T* l = &laplacian(0, j, k);
+    for (int i = i_begin; i < i_end; ++i) {
+      const T two_f = static_cast<T>(2.) * f[i];
+      l[i] = (f[i + 1] - two_f + f[i - 1]) * one_by_dx2[0] + (f[i + sy] - two_f + f[i - sy]) * one_by_dx2[1] +
+             (f[i + sz] - two_f + f[i - sz]) * one_by_dx2[2];
+    }
+  });
+}
+
+template <typename T>
+void EXAMPLES::computeMeanCurvature(const Array<Grid<T, 3>, T>& field, Array<Grid<T, 3>, T>& curvature,
+                                    const unsigned num_threads)
+{
+  ptrdiff_t sy, sz;
+  nodeStrides(field, sy, sz);
+
+  const auto dx = field.grid().dX();
+  const T half_by_dx[3] = {static_cast<T>(0.5) / dx[0], static_cast<T>(0.5) / dx[1], static_cast<T>(0.5) / dx[2]};
+  const T one_by_dx2[3] = {static_cast<T>(1.) / (dx[0] * dx[0]), static_cast<T>(1.) / (dx[1] * dx[1]),
+                           static_cast<T>(1.) / (dx[2] * dx[2])};
+  const T quarter_by_dxy = static_cast<T>(0.25) / (dx[0] * dx[1]);
+  const T quarter_by_dxz = static_cast<T>(0.25) / (dx[0] * dx[2]);
+  const T quarter_by_dyz = static_cast<T>(0.25) / (dx[1] * dx[2]);
+
+  forEachNodeRow(field.grid(), num_threads, [&](const int i_begin, const int i_end, const int j, const int k) {
+    const T* f = &field(0, j, k);
+    T* c = &curvature(0, j, k);
+    for (int i = i_begin; i < i_end; ++i) {
+      const T gx = (f[i + 1] - f[i - 1]) * half_by_dx[0];
+      const T gy = (f[i + sy] - f[i - sy]) * half_by_dx[1];
+      const T gz = (f[i + sz] - f[i - sz]) * half_by_dx[2];
+
+      const T two_f = static_cast<T>(2.) * f[i];
+      const T hxx = (f[i + 1] - two_f + f[i - 1]) * one_by_dx2[0];
+      const T hyy = (f[i + sy] - two_f + f[i - sy]) * one_by_dx2[1];
+      const T hzz = (f[i + sz] - two_f + f[i - sz]) * one_by_dx2[2];
+      const T hxy = (f[i + 1 + sy] - f[i + 1 - sy] - f[i - 1 + sy] + f[i - 1 - sy]) * quarter_by_dxy;
+      const T hxz = (f[i + 1 + sz] - f[i + 1 - sz] - f[i - 1 + sz] + f[i - 1 - sz]) * quarter_by_dxz;
+      const T hyz = (f[i + sy + sz] - f[i + sy - sz] - f[i - sy + sz] + f[i - sy - sz]) * quarter_by_dyz;
+
+      const T gx2 = gx * gx, gy2 = gy * gy, gz2 = gz * gz;
+      const T g2 = gx2 + gy2 + gz2;
+      const T numerator = gx2 * (hyy + hzz) + gy2 * (hxx + hzz) + gz2 * (hxx + hyy) -
+                          static_cast<T>(2.) * (gx * gy * hxy + gx * gz * hxz + gy * gz * hyz);
+      c[i] = g2 > 0 ? numerator / (g2 * sqrt(g2)) : static_cast<T>(0.);
+    }
+  });
+}
+
+template void EXAMPLES::computeGradient<float>(const Array<Grid<float, 3>, float>&,
+                                               Array<Grid<float, 3>, SCALAR_POLYGONIZATION::Vec3<float>>&,
+                                               const float, const unsigned);
+template void EXAMPLES::computeGradient<double>(const Array<Grid<double, 3>, double>&,
+                                                Array<Grid<double, 3>, SCALAR_POLYGONIZATION::Vec3<double>>&,
+                                                const double, const unsigned);
+template void EXAMPLES::computeLaplacian<float>(const Array<Grid<float, 3>, float>&, Array<Grid<float, 3>, float>&,
+                                                const unsigned);
+template void EXAMPLES::computeLaplacian<double>(const Array<Grid<double, 3>, double>&,
+                                                 Array<Grid<double, 3>, double>&, const unsigned);
+template void EXAMPLES::computeMeanCurvature<float>(const Array<Grid<float, 3>, float>&,
+                                                    Array<Grid<float, 3>, float>&, const unsigned);
+template void EXAMPLES::computeMeanCurvature<double>(const Array<Grid<double, 3>, double>&,
+                                                     Array<Grid<double, 3>, double>&, const unsigned);
@@ -0,0 +1,123 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright 2019 Lakshman Anumolu.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "array.h"
+#include "grid.h"
+#include "scalar_polygonization/parallel.h"
+#include "scalar_polygonization/vec3.h"
+
+#include <algorithm>
+
+namespace EXAMPLES
+{
+//! Nodes along x, rows along y and planes along z in a tile of `forEachNodeRow`.
+constexpr int STENCIL_TILE_NODES = 512;
+constexpr int STENCIL_TILE_ROWS = 8;
+constexpr int STENCIL_TILE_PLANES = 32;
+
+/*! Run `row(i_begin, i_end, j, k)` over all interior nodes of a 3D grid, in memory order within cache sized tiles.
+ *
+ * Planes are split into slabs along z as by `polygonizeVolume`, thread t always running the same slabs (see
+ * `parallelForStatic`), which are the planes it initialized in an `Array` built with the same number of threads.
+ * Slabs are split into tiles of `STENCIL_TILE_NODES x STENCIL_TILE_ROWS x STENCIL_TILE_PLANES` nodes. Inside a tile
+ * planes are visited in increasing k, rows in increasing j, and `row` is called on a contiguous run of nodes along x
+ * (the unit stride axis), so that a 7-point stencil reads the three planes of the tile from cache and its inner loop
+ * vectorizes.
+ *
+ * \param grid grid whose interior nodes `0 <= i, j, k < numCells()` are visited.
+ * \param num_threads number of threads, 0 for all hardware threads.
+ * \param row callable taking first and last + 1 node along x, and indices of the row along y and z.
+ */
+template <typename T, typename F>
+void forEachNodeRow(const Grid<T, 3>& grid, const unsigned num_threads, F&& row)
+{
+  const auto num_cells = grid.numCells();
+  const size_t num_slabs = SCALAR_POLYGONIZATION::numSlabs(num_cells[2], num_threads);
+
+  SCALAR_POLYGONIZATION::parallelForStatic(num_slabs, num_threads, [&](const size_t s) {
+    const int slab_begin = static_cast<int>(SCALAR_POLYGONIZATION::slabBegin(num_cells[2], num_slabs, s));
+    const int slab_end = static_cast<int>(SCALAR_POLYGONIZATION::slabBegin(num_cells[2], num_slabs, s + 1));
+
+    for (int k_begin = slab_begin; k_begin < slab_end; k_begin += STENCIL_TILE_PLANES)
+      for (int j_begin = 0; j_begin < num_cells[1]; j_begin += STENCIL_TILE_ROWS)
+        for (int i_begin = 0; i_begin < num_cells[0]; i_begin += STENCIL_TILE_NODES) {
+          const int i_end = std::min(i_begin + STENCIL_TILE_NODES, num_cells[0]);
+          const int j_end = std::min(j_begin + STENCIL_TILE_ROWS, num_cells[1]);
+          const int k_end = std::min(k_begin + STENCIL_TILE_PLANES, slab_end);
+          for (int k = k_begin; k < k_end; ++k)
+            for (int j = j_begin; j < j_end; ++j) row(i_begin, i_end, j, k);
+        }
+  });
+}
+
+/*! Central-difference gradient of a scalar field at interior nodes.
+ *
+ * Ghost nodes of `gradient` are left unchanged.
+ *
+ * \param field scalar field, read at interior nodes and their neighbours, its grid needs `getPadding() >= 1`
+ *        or `std::runtime_error` is thrown.
+ * \param gradient gradient on the same grid.
+ * \param scale factor applied to gradients, e.g. -1 for normals towards decreasing values.
+ * \param num_threads number of threads, 0 for all hardware threads.
+ */
+template <typename T>
+void computeGradient(const Array<Grid<T, 3>, T>& field, Array<Grid<T, 3>, SCALAR_POLYGONIZATION::Vec3<T>>& gradient,
+                     const T scale = 1, const unsigned num_threads = 1);
+
+/*! 7-point Laplacian of a scalar field at interior nodes.
+ *
+ * Ghost nodes of `laplacian` are left unchanged.
+ *
+ * \param field scalar field, read at interior nodes and their neighbours, its grid needs `getPadding() >= 1`
+ *        or `std::runtime_error` is thrown.
+ * \param laplacian Laplacian on the same grid.
+ * \param num_threads number of threads, 0 for all hardware threads.
+ */
+template <typename T>
+void computeLaplacian(const Array<Grid<T, 3>, T>& field, Array<Grid<T, 3>, T>& laplacian,
+                      const unsigned num_threads = 1);
+
+/*! Mean curvature `div(grad f / |grad f|)` of the iso-surfaces of a scalar field at interior nodes.
+ *
+ * Computed from central differences as `(|g|^2 trace(H) - g^T H g) / |g|^3` with gradient g and Hessian H, zero where
+ * the gradient vanishes. Ghost nodes of `curvature` are left unchanged.
+ *
+ * \param field scalar field, read at interior nodes and their neighbours (including diagonal ones), its grid needs
+ *        `getPadding() >= 1` or `std::runtime_error` is thrown.
+ * \param curvature curvature on the same grid.
+ * \param num_threads number of threads, 0 for all hardware threads.
+ */
+template <typename T>
+void computeMeanCurvature(const Array<Grid<T, 3>, T>& field, Array<Grid<T, 3>, T>& curvature,
+                          const unsigned num_threads = 1);
+}  // namespace EXAMPLES
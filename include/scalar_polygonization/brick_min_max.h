@@ -0,0 +1,135 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright 2019 Lakshman Anumolu.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "scalar_polygonization/polygonize_volume.h"
+#include "scalar_polygonization/vec3.h"
+
+#include <vector>
+
+namespace SCALAR_POLYGONIZATION
+{
+/*!
+ * \class BrickMinMax
+ *
+ * Range of scalar values over bricks of `BRICK_SIZE`^3 cubes of a `ScalarVolume`.
+ *
+ * Brick (bi, bj, bk) covers cubes `BRICK_SIZE * (bi, bj, bk)` to `BRICK_SIZE * (bi + 1, bj + 1, bk + 1) - 1`, the
+ * last brick along an axis may be smaller. Its range includes all nodes of these cubes, so nodes on faces between
+ * bricks count for both. A brick whose range does not contain the iso-value has all its nodes on the same side of the
+ * surface, and `polygonizeVolume` skips it without reading its scalars.
+ */
+template <typename T>
+class BrickMinMax
+{
+ public:
+  static constexpr int BRICK_SIZE = 8;  //!< Number of cubes along each side of a brick.
+
+  /*! Constructor, computes ranges of all bricks.
+   *
+   * \param volume scalar field.
+   * \param num_threads number of threads, 0 for all hardware threads.
+   */
+  explicit BrickMinMax(const ScalarVolume<T>& volume, const unsigned num_threads = 1);
+
+  /*! Recompute ranges of bricks containing modified nodes.
+   *
+   * \param volume scalar field, with the same dimensions as on construction.
+   * \param node_begin first modified node along x, y, z.
+   * \param node_end one past the last modified node along x, y, z.
+   */
+  void update(const ScalarVolume<T>& volume, const Vec3<int>& node_begin, const Vec3<int>& node_end);
+
+  /*! Returns number of nodes along x, y, z of the volume the ranges were computed for.
+   */
+  const Vec3<int> dims() const { return Vec3<int>(m_dims[0], m_dims[1], m_dims[2]); }
+
+  /*! Returns number of bricks along an axis.
+   *
+   * \param axis 0, 1, 2 for x, y, z.
+   */
+  int numBricks(const int axis) const { return m_num_bricks[axis]; }
+
+  /*! Returns minimum scalar value of brick (bi, bj, bk).
+   */
+  T min(const int bi, const int bj, const int bk) const { return m_min[this->index(bi, bj, bk)]; }
+
+  /*! Returns maximum scalar value of brick (bi, bj, bk).
+   */
+  T max(const int bi, const int bj, const int bk) const { return m_max[this->index(bi, bj, bk)]; }
+
+  /*! Whether brick (bi, bj, bk) may contain cubes intersected by the iso-surface.
+   *
+   * \param bi index of the brick along x-direction.
+   * \param bj index of the brick along y-direction.
+   * \param bk index of the brick along z-direction.
+   * \param iso_alpha value for which iso-surface needs to be extracted.
+   *
+   * \return false if all nodes of the brick are inside (`< iso_alpha`) or all are outside.
+   */
+  bool intersects(const int bi, const int bj, const int bk, const T iso_alpha) const
+  {
+    const size_t b = this->index(bi, bj, bk);
+    return m_min[b] < iso_alpha && !(m_max[b] < iso_alpha);
+  }
+
+ private:
+  size_t index(const int bi, const int bj, const int bk) const
+  {
+    return static_cast<size_t>(bi) + m_num_bricks[0] * (static_cast<size_t>(bj) + m_num_bricks[1] * bk);
+  }
+
+  void computeBrick(const ScalarVolume<T>& volume, const int bi, const int bj, const int bk);
+
+  int m_dims[3];
+  int m_num_bricks[3];
+  std::vector<T> m_min;
+  std::vector<T> m_max;
+};
+
+/*! Polygonize a scalar volume with marching cubes, skipping bricks away from the iso-surface.
+ *
+ * Same as `polygonizeVolume(volume, iso_alpha, options)`, but nodes of bricks whose range excludes `iso_alpha` are
+ * classified from the brick range alone and their cubes are never visited.
+ *
+ * \param volume scalar field to polygonize.
+ * \param bricks value ranges of bricks of `volume`, up to date with its values. Ranges computed for a volume of other
+ *        dimensions throw `std::invalid_argument`.
+ * \param iso_alpha value for which iso-surface needs to be extracted.
+ * \param options extraction options.
+ *
+ * \return indexed triangle mesh.
+ */
+template <typename T>
+IndexedMesh<T> polygonizeVolume(const ScalarVolume<T>& volume, const BrickMinMax<T>& bricks, const T iso_alpha,
+                                const PolygonizeOptions& options = PolygonizeOptions());
+}  // namespace SCALAR_POLYGONIZATION
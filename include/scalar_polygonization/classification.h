@@ -0,0 +1,138 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright 2019 Lakshman Anumolu.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(__FLT16_MAX__)
+//! Defined when the compiler provides the IEEE half precision `_Float16` type, volumes of which can be polygonized.
+#define SP_HAS_FLOAT16 1
+#endif
+
+namespace SCALAR_POLYGONIZATION
+{
+/*! Number of 64 bit words needed by `classifyNodes` for a row of nodes.
+ *
+ * One extra word is kept, so that `activeCubes` can read node `i + 1` of the last word without a branch.
+ *
+ * \param num_nodes number of nodes in a row.
+ *
+ * \return number of words.
+ */
+inline size_t classificationWords(const int num_nodes)
+{
+  return static_cast<size_t>(num_nodes + 63) / 64 + 1;
+}
+
+/*! Classify a row of nodes against the iso-surface value.
+ *
+ * Bit `i % 64` of `bits[i / 64]` is set if `row[i * stride] < iso_alpha`, i.e. node `i` is inside the surface as in
+ * `MarchingCubes::marchCube`. Contiguous rows of `float` and `double` are compared with SSE2/AVX2, rows of `uint8_t`
+ * and `uint16_t` with SSE2 (when enabled at compile time), others use a scalar loop.
+ *
+ * \param row pointer to the first node of the row.
+ * \param stride distance between two consecutive nodes in number of elements.
+ * \param num_nodes number of nodes in the row.
+ * \param iso_alpha value for which iso-surface needs to be extracted.
+ * \param bits output, `classificationWords(num_nodes)` words.
+ */
+template <typename T>
+void classifyNodes(const T* row, const size_t stride, const int num_nodes, const T iso_alpha, uint64_t* bits);
+
+/*! Classify nodes `begin <= i < end` of a row, leaving bits of other nodes untouched.
+ *
+ * Bits are or-ed into `bits`, which must be cleared for these nodes. Ranges starting at a multiple of 8 (16 for
+ * integer types) use the vectorized loops of `classifyNodes` throughout.
+ *
+ * \param row pointer to node 0 of the row.
+ * \param stride distance between two consecutive nodes in number of elements.
+ * \param begin first node to classify.
+ * \param end one past the last node to classify.
+ * \param iso_alpha value for which iso-surface needs to be extracted.
+ * \param bits output, bitmask of the whole row as in `classifyNodes`.
+ */
+template <typename T>
+void classifyNodeRange(const T* row, const size_t stride, const int begin, const int end, const T iso_alpha,
+                       uint64_t* bits);
+
+/*! Map an iso-value to the storage type of node values, to classify quantized or half precision nodes directly.
+ *
+ * `static_cast<T>(value) < iso_alpha` holds if and only if `value < threshold`, for every value of type S. For
+ * integer types the threshold is `iso_alpha` rounded up, for `_Float16` the smallest half not below `iso_alpha`.
+ *
+ * \param iso_alpha value for which iso-surface needs to be extracted.
+ * \param threshold output, value to pass to `classifyNodes`.
+ *
+ * \return false if every value of type S is below `iso_alpha`, `threshold` is then left unset.
+ */
+template <typename S, typename T>
+bool classificationThreshold(const T iso_alpha, S& threshold);
+
+/*! List cubes of a row that intersect the iso-surface.
+ *
+ * A row of cubes between node rows (j, k), (j + 1, k), (j, k + 1) and (j + 1, k + 1) is classified from bitmasks of
+ * these node rows (from `classifyNodes`), 64 cubes at a time. Cubes with all vertices inside or all outside are
+ * skipped, for the others index and case (`vertex_flag` of `MarchingCubes::marchCube`) are written.
+ *
+ * \param row_00 bitmask of nodes (j, k).
+ * \param row_10 bitmask of nodes (j + 1, k).
+ * \param row_01 bitmask of nodes (j, k + 1).
+ * \param row_11 bitmask of nodes (j + 1, k + 1).
+ * \param num_cubes number of cubes in the row, i.e. number of nodes - 1.
+ * \param cubes output, indices of intersected cubes, up to `num_cubes`.
+ * \param cases output, case of each intersected cube, up to `num_cubes`.
+ *
+ * \return number of intersected cubes.
+ */
+int activeCubes(const uint64_t* row_00, const uint64_t* row_10, const uint64_t* row_01, const uint64_t* row_11,
+                const int num_cubes, int* cubes, uint8_t* cases);
+
+/*! Number of grid edges along a row of nodes intersected by the iso-surface.
+ *
+ * \param row bitmask of the nodes (from `classifyNodes`).
+ * \param num_nodes number of nodes in the row.
+ *
+ * \return number of edges (i, i + 1) with one node inside and the other outside.
+ */
+int crossedEdgesAlongRow(const uint64_t* row, const int num_nodes);
+
+/*! Number of grid edges between two rows of nodes intersected by the iso-surface.
+ *
+ * \param row_0 bitmask of the first row of nodes (from `classifyNodes`).
+ * \param row_1 bitmask of the second row of nodes, adjacent along y or z.
+ * \param num_nodes number of nodes in each row.
+ *
+ * \return number of edges joining node i of both rows with one node inside and the other outside.
+ */
+int crossedEdgesBetweenRows(const uint64_t* row_0, const uint64_t* row_1, const int num_nodes);
+}  // namespace SCALAR_POLYGONIZATION
@@ -0,0 +1,82 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright 2019 Lakshman Anumolu.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "scalar_polygonization/polygonize_volume.h"
+#include "scalar_polygonization/vec3.h"
+
+#include <stdint.h>
+
+#include <vector>
+
+namespace SCALAR_POLYGONIZATION
+{
+/*! Encode a mesh whose vertices lie on edges of a uniform grid, as meshes of `polygonizeVolume` do.
+ *
+ * The mesh must come with the grid edge and weight of each vertex, i.e. be extracted with
+ * `PolygonizeOptions::vertex_edges`. Positions are not read, so the encoding does not depend on their rounding. Each
+ * vertex is stored as its grid edge, given as the lowest cube holding the edge and the edge in that cube, and its
+ * position along the edge quantized to `weight_bits` bits. Cube indices are stored as differences to the cube of the
+ * previous vertex, triangle vertex indices as differences to the next vertex not used yet by a triangle, both in
+ * LEB128 variable length integers: vertices and triangles follow the marching order, so most differences take one
+ * byte. Normals are not stored.
+ *
+ * With 16 bit weights, vertices are within `spacing / 2^17` of their position, about the precision of a float
+ * coordinate in a grid of 128 nodes per axis.
+ *
+ * Errors (missing edges or weights, edges outside of the grid, `weight_bits` out of range) throw
+ * `std::runtime_error`.
+ *
+ * \param mesh mesh with `edges` and `weights` of its vertices.
+ * \param dims number of nodes along x, y, z.
+ * \param origin position of node (0, 0, 0).
+ * \param spacing distance between two consecutive nodes along x, y, z.
+ * \param weight_bits bits of the position along an edge, in [1, 16].
+ *
+ * \return encoded mesh.
+ */
+template <typename T>
+std::vector<uint8_t> compressMesh(const IndexedMesh<T>& mesh, const Vec3<int>& dims, const Vec3<T>& origin,
+                                  const Vec3<T>& spacing, const int weight_bits = 16);
+
+/*! Decode a mesh encoded by `compressMesh`.
+ *
+ * Malformed data throws `std::runtime_error`.
+ *
+ * \param data encoded mesh.
+ * \param size number of bytes of `data`.
+ *
+ * \return mesh without normals, with the edges and quantized weights of its vertices.
+ */
+template <typename T>
+IndexedMesh<T> decompressMesh(const uint8_t* data, const size_t size);
+}  // namespace SCALAR_POLYGONIZATION
@@ -0,0 +1,105 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright 2019 Lakshman Anumolu.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "scalar_polygonization/tables.h"
+
+namespace SCALAR_POLYGONIZATION
+{
+/*!
+ * \class Convention1
+ *
+ * Ordering of cube vertices of Convention-1 (see `MarchingCubes`), as a policy of `MarchingCubes`.
+ *
+ * A convention numbers the 8 vertices of a cube. Edges join the same pairs of vertex numbers in all conventions
+ * (`edge_connection`), so `edge_table` and `triangle_table` apply to any of them. All members are `constexpr`, so
+ * that lookups are folded into the kernel when the vertex or edge number is known at compile time.
+ */
+struct Convention1 {
+  //! True if the convention is a mirror image of Convention-1, triangle winding is then reversed by the kernel.
+  static constexpr bool MIRRORED = false;
+
+  /*! Offset of a cube vertex from vertex 0.
+   *
+   * \param vertex vertex number (0-7).
+   * \param axis 0, 1, 2 for x, y, z.
+   *
+   * \return 0 or 1.
+   */
+  static constexpr int vertexOffset(const int vertex, const int axis)
+  {
+    return static_cast<int>(vertex_offset[vertex][axis]);
+  }
+
+  /*! Vertex at one end of a cube edge.
+   *
+   * \param edge edge number (0-11).
+   * \param end 0 or 1.
+   *
+   * \return vertex number.
+   */
+  static constexpr int edgeVertex(const int edge, const int end) { return edge_connection[edge][end]; }
+
+  /*! Vertex whose id gives the id of an edge in `MarchingCubes::vertexToEdgeIds`.
+   *
+   * \param edge edge number (0-11).
+   */
+  static constexpr int edgeBaseVertex(const int edge) { return edge_id_to_vertex_id_base_map[edge]; }
+
+  /*! Multiple of the offset added to the id of the base vertex in `MarchingCubes::vertexToEdgeIds`.
+   *
+   * \param edge edge number (0-11).
+   */
+  static constexpr int edgeIdOffset(const int edge) { return edge_id_to_vertex_id_offset_map[edge]; }
+};
+
+/*!
+ * \class Convention2
+ *
+ * Ordering of cube vertices of Convention-2 (Ref.: http://paulbourke.net/geometry/polygonise/), i.e. Convention-1
+ * with y and z swapped.
+ */
+struct Convention2 {
+  static constexpr bool MIRRORED = true;
+
+  static constexpr int vertexOffset(const int vertex, const int axis)
+  {
+    return static_cast<int>(convention_2_vertex_offset[vertex][axis]);
+  }
+
+  static constexpr int edgeVertex(const int edge, const int end) { return edge_connection[edge][end]; }
+
+  static constexpr int edgeBaseVertex(const int edge) { return edge_id_to_vertex_id_base_map[edge]; }
+
+  static constexpr int edgeIdOffset(const int edge) { return convention_2_edge_id_to_vertex_id_offset_map[edge]; }
+};
+}  // namespace SCALAR_POLYGONIZATION
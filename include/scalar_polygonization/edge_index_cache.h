@@ -0,0 +1,126 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright 2019 Lakshman Anumolu.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "scalar_polygonization/conventions.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+namespace SCALAR_POLYGONIZATION
+{
+/*!
+ * \class EdgeIndexCache
+ *
+ * Indices of surface vertices on grid edges, for one layer of cubes at a time.
+ *
+ * Cubes are visited layer by layer along z. A layer of cubes between node planes `k` and `k + 1` touches x- and
+ * y-edges of both planes and z-edges between them, so only two planes of x/y edges and one plane of z edges are
+ * stored. Each vertex is created by the first cube that touches its edge, neighbouring cubes find its index here.
+ *
+ * Edge of node (i, j) along `axis` connects it to node (i, j) + unit vector along `axis`.
+ */
+class EdgeIndexCache
+{
+ public:
+  static constexpr uint32_t INVALID = UINT32_MAX;  //!< Index of an edge without a vertex.
+
+  /*! Constructor.
+   *
+   * \param nx number of nodes along x-direction.
+   * \param ny number of nodes along y-direction.
+   * \param convention ordering of cube vertices used by `MarchingCubes`, `Convention1` or `Convention2`.
+   */
+  template <typename Convention = Convention1>
+  EdgeIndexCache(const int nx, const int ny, const Convention convention = Convention());
+
+  /*! Default destructor.
+   */
+  ~EdgeIndexCache();
+
+  /*! Invalidate all stored indices, to start a new volume.
+   */
+  void reset();
+
+  /*! Move to the next layer of cubes.
+   *
+   * The top plane of the current layer becomes the bottom plane, the new top plane and z-edges are invalidated.
+   */
+  void advance();
+
+  /*! Reference to vertex index on an edge of a cube in the current layer.
+   *
+   * \param edge edge number (0-11) of the cube as in `MarchingCubes`, for the convention given on construction.
+   * \param i index of the cube along x-direction.
+   * \param j index of the cube along y-direction.
+   *
+   * \return reference to vertex index, `INVALID` if no vertex was created on this edge yet.
+   */
+  uint32_t& operator()(const int edge, const int i, const int j)
+  {
+    const auto& e = m_cube_edges[edge];
+    return m_planes[e.plane][e.slot + 3 * (static_cast<size_t>(i + e.di) + m_nx * static_cast<size_t>(j + e.dj))];
+  }
+
+  /*! Reference to vertex index on an edge of a node.
+   *
+   * \param axis direction of the edge, 0, 1, 2 for x, y, z.
+   * \param i index of the node along x-direction.
+   * \param j index of the node along y-direction.
+   * \param top true for a node on the top plane of the current layer. z-edges are stored only for the bottom plane.
+   *
+   * \return reference to vertex index, `INVALID` if no vertex was created on this edge yet.
+   */
+  uint32_t& edge(const int axis, const int i, const int j, const bool top)
+  {
+    return m_planes[top ? m_top : 1 - m_top][axis + 3 * (static_cast<size_t>(i) + m_nx * static_cast<size_t>(j))];
+  }
+
+ private:
+  //! Location of a cube edge relative to the cube.
+  struct CubeEdge {
+    int plane;  //!< Index into `m_planes`, updated on `advance()`.
+    int slot;   //!< Axis of the edge.
+    int di;     //!< Offset of the first node of the edge along x.
+    int dj;     //!< Offset of the first node of the edge along y.
+    bool top;   //!< True if the edge lies on the top plane of the layer.
+  };
+
+  void updateCubeEdges();
+
+  std::size_t m_nx, m_ny;
+  int m_top;
+  CubeEdge m_cube_edges[12];
+  std::vector<uint32_t> m_planes[2];  //!< x, y, z edges of each node, for two node planes.
+};
+}  // namespace SCALAR_POLYGONIZATION
@@ -0,0 +1,53 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright 2019 Lakshman Anumolu.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <stddef.h>
+
+namespace SCALAR_POLYGONIZATION
+{
+//! Most characters written by `floatToText`.
+constexpr size_t MAX_FLOAT_TEXT = 16;
+
+/*! Write the shortest decimal text which reads back as `value`.
+ *
+ * Digits are found with the Ryu algorithm (Adams, PLDI 2018): the shortest decimal in the interval of reals rounding
+ * to `value`, the closest one to `value` if there are several. Numbers with a decimal exponent in [-5, 8] are written
+ * in fixed notation, others in scientific notation, e.g. `0.1`, `-2.5`, `100`, `1e-7`, `3.4028235e38`. Infinities
+ * are written as `inf` and `-inf`, NaN as `nan`. The text does not depend on the locale and is not null terminated.
+ *
+ * \param value value to write.
+ * \param text buffer of at least `MAX_FLOAT_TEXT` characters.
+ * \return number of characters written.
+ */
+size_t floatToText(const float value, char* text);
+}  // namespace SCALAR_POLYGONIZATION
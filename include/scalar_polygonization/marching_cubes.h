@@ -35,10 +35,12 @@
 
 #pragma once
 
+#include "scalar_polygonization/conventions.h"
 #include "scalar_polygonization/utilities.h"
 #include "scalar_polygonization/vec3.h"
 
 #include <limits.h>
+#include <array>
 #include <tuple>
 #include <vector>
 
@@ -133,6 +135,32 @@ class Triangle
 template <typename T>
 using TriangleVertexTuple_t = std::tuple<std::vector<Triangle<T>>, std::vector<Vertex<T>>>;
 
+/*!
+ * \class CubeTriangulation
+ *
+ * Fixed-size storage for the surface inside a single cube.
+ *
+ * Filled by `MarchingCubes<T>::marchCube` without any heap allocation, so one object can be reused for every cube
+ * of a volume. Vertices are stored per intersected edge, triangle corners refer to these vertex slots.
+ */
+template <typename T>
+class CubeTriangulation
+{
+ public:
+  static constexpr int MAX_TRIANGLES = 5;  //!< Maximum number of triangles generated by a cube.
+  static constexpr int MAX_VERTICES = 12;  //!< Maximum number of intersected edges of a cube.
+
+  CubeTriangulation() : num_triangles(0), num_vertices(0) {}
+
+  int num_triangles;                 //!< Number of triangles in the cube.
+  int num_vertices;                  //!< Number of intersected edges (/vertices) in the cube.
+  int edges[MAX_VERTICES];           //!< Cube edge (0-11) on which each vertex lies.
+  T weights[MAX_VERTICES];           //!< Normalized distance of each vertex from the first vertex of its edge.
+  Vec3<T> positions[MAX_VERTICES];   //!< Position of each vertex.
+  Vec3<T> normals[MAX_VERTICES];     //!< Normal at each vertex, interpolated from the cube vertices.
+  int triangles[3 * MAX_TRIANGLES];  //!< Vertex slots of triangle corners, three per triangle.
+};
+
 /*!
  * \class MarchingCubes
  *
@@ -246,8 +274,14 @@ using TriangleVertexTuple_t = std::tuple<std::vector<Triangle<T>>, std::vector<V
  *     |    9           |  V1 + 1 * offset + 1 |
  *     |    10          |  V2 + 1 * offset + 1 |
  *     |    11          |  V3 + 1 * offset + 1 |
+ *
+ * - The convention is a policy type, `Convention1` (default) or `Convention2`, so that cube vertices can be passed in
+ *   the native ordering of a solver. Triangles face the same way in space for both conventions.
+ *
+ * \tparam T floating point type.
+ * \tparam Convention ordering of cube vertices.
  */
-template <typename T = float>
+template <typename T = float, typename Convention = Convention1>
 class MarchingCubes
 {
  public:
@@ -270,6 +304,14 @@ class MarchingCubes
    */
   std::vector<size_t> vertexToEdgeIds(const std::size_t offset, const std::vector<size_t>& vertex_ids);
 
+  /*! Compute edge ids using vertex ids in a cube, without allocating.
+   *
+   * \param offset added to avoid collision between two edges in the same cell.
+   * \param vertex_ids ids of 8 vertices of a cube.
+   * \param edge_ids output, ids of 12 edges of a cube.
+   */
+  void vertexToEdgeIds(const std::size_t offset, const std::size_t* vertex_ids, std::size_t* edge_ids) const;
+
   /*! Returns normalized distance of the iso-surface intersection from vertex-1.
    *
    * - Usage:
@@ -302,5 +344,38 @@ class MarchingCubes
   TriangleVertexTuple_t<T> marchCube(const std::vector<Vec3<T>>& cube_vertices, const std::vector<size_t>& edge_ids,
                                      const std::vector<T>& scalars, const std::vector<Vec3<T>>& normals,
                                      const T iso_alpha);
+
+  /*! Marching cubes algorithm on a single cube, writing into caller-owned storage.
+   *
+   * Same as the overload above, but does not allocate: results are written into `triangulation`, which is
+   * overwritten on every call. Triangle normals are not computed, vertex normals are interpolated only if `normals`
+   * is not a null pointer.
+   *
+   * \param cube_vertices pointer to position vectors of 8 vertices of a cube.
+   * \param scalars pointer to scalar values at 8 vertices of a cube.
+   * \param normals pointer to normal vectors at 8 vertices of a cube, can be nullptr.
+   * \param iso_alpha value for which iso-surface needs to be extracted.
+   * \param triangulation output, triangles and vertices of the cube.
+   *
+   * \return number of triangles in the cube.
+   */
+  int marchCube(const Vec3<T>* cube_vertices, const T* scalars, const Vec3<T>* normals, const T iso_alpha,
+                CubeTriangulation<T>& triangulation) const;
+
+  /*! Marching cubes algorithm on a single cube, writing into caller-owned storage.
+   *
+   * \param cube_vertices position vectors of 8 vertices of a cube.
+   * \param scalars scalar values at 8 vertices of a cube.
+   * \param normals normal vectors at 8 vertices of a cube.
+   * \param iso_alpha value for which iso-surface needs to be extracted.
+   * \param triangulation output, triangles and vertices of the cube.
+   *
+   * \return number of triangles in the cube.
+   */
+  int marchCube(const std::array<Vec3<T>, 8>& cube_vertices, const std::array<T, 8>& scalars,
+                const std::array<Vec3<T>, 8>& normals, const T iso_alpha, CubeTriangulation<T>& triangulation) const
+  {
+    return this->marchCube(cube_vertices.data(), scalars.data(), normals.data(), iso_alpha, triangulation);
+  }
 };
 }  // namespace SCALAR_POLYGONIZATION
@@ -0,0 +1,83 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright 2019 Lakshman Anumolu.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "scalar_polygonization/polygonize_volume.h"
+
+#include <string>
+
+namespace SCALAR_POLYGONIZATION
+{
+/*! Write a mesh as a binary PLY file.
+ *
+ * Vertices have `x`, `y`, `z` (and `nx`, `ny`, `nz` if the mesh has normals) properties of type T, faces a list of
+ * three `uint` vertex indices. Values are in the byte order of the host, which the header declares. Arrays of the
+ * mesh are copied into large blocks before writing, without formatting. PLY has no 64 bit integers, a mesh of more than
+ * 2^32 vertices cannot be written.
+ *
+ * Errors throw `std::runtime_error`.
+ *
+ * \param file_name path of the file.
+ * \param mesh mesh to write.
+ */
+template <typename T, typename I>
+void writePly(const std::string& file_name, const IndexedMesh<T, I>& mesh);
+
+/*! Write a mesh as a binary STL file.
+ *
+ * Each triangle is written with its three vertex positions and the unit normal of its winding, as 32 bit floats in
+ * little endian byte order on any host. STL does not share vertices between triangles, and counts them with 32 bits,
+ * a mesh of more than 2^32 - 1 triangles cannot be written.
+ *
+ * Errors throw `std::runtime_error`.
+ *
+ * \param file_name path of the file.
+ * \param mesh mesh to write.
+ */
+template <typename T, typename I>
+void writeStl(const std::string& file_name, const IndexedMesh<T, I>& mesh);
+
+/*! Write a mesh as an ASCII OBJ file.
+ *
+ * Vertices are written as `v` lines, normals (if the mesh has them) as `vn` lines sharing the vertex indices, and
+ * triangles as `f` lines. Floats are written with the fewest digits reading back exactly (`floatToText`), doubles with
+ * 17 significant digits. Chunks of lines are formatted in parallel and written together with `writev`.
+ *
+ * Errors throw `std::runtime_error`.
+ *
+ * \param file_name path of the file.
+ * \param mesh mesh to write.
+ * \param num_threads number of threads formatting lines, 0 for all hardware threads.
+ */
+template <typename T, typename I>
+void writeObj(const std::string& file_name, const IndexedMesh<T, I>& mesh, const unsigned num_threads = 0);
+}  // namespace SCALAR_POLYGONIZATION
@@ -0,0 +1,171 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright 2019 Lakshman Anumolu.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <stddef.h>
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace SCALAR_POLYGONIZATION
+{
+/*! Number of threads to run with.
+ *
+ * \param num_threads requested number of threads, 0 for all hardware threads.
+ *
+ * \return number of threads, at least 1.
+ */
+inline unsigned numThreads(const unsigned num_threads)
+{
+  if (num_threads) return num_threads;
+
+  const unsigned hardware_threads = std::thread::hardware_concurrency();
+  return hardware_threads ? hardware_threads : 1;
+}
+
+/*! Number of slabs of consecutive layers `num_layers` layers are split into for `num_threads` threads.
+ *
+ * A few slabs per thread, to balance slabs with different amount of work, and at least one slab.
+ *
+ * \param num_layers number of layers.
+ * \param num_threads number of threads, 0 for all hardware threads.
+ */
+inline size_t numSlabs(const size_t num_layers, const unsigned num_threads)
+{
+  const size_t n = numThreads(num_threads);
+  return std::max<size_t>(1, std::min(num_layers, n > 1 ? 4 * n : 1));
+}
+
+/*! First layer of slab `s` when `num_layers` layers are split into `num_slabs` slabs of nearly the same size.
+ *
+ * Slab `s` runs from `slabBegin(num_layers, num_slabs, s)` to `slabBegin(num_layers, num_slabs, s + 1)`.
+ */
+inline size_t slabBegin(const size_t num_layers, const size_t num_slabs, const size_t s)
+{
+  return num_layers * s / num_slabs;
+}
+
+/*! Run `worker(t)` for all `0 <= t < n`, on the calling thread for `t = 0` and on a new thread for others.
+ *
+ * The first exception thrown by a worker is rethrown once all threads are done, `stop` is called when it is caught so
+ * that other workers can stop early.
+ */
+template <typename F, typename G>
+void runThreads(const size_t n, F&& worker, G&& stop)
+{
+  std::exception_ptr error;
+  std::mutex error_mutex;
+  auto guarded_worker = [&](const size_t t) {
+    try {
+      worker(t);
+    } catch (...) {
+      stop();
+      std::lock_guard<std::mutex> lock(error_mutex);
+      if (!error) error = std::current_exception();
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (size_t t = 1; t < n; ++t) threads.emplace_back(guarded_worker, t);
+
+  guarded_worker(0);
+  for (auto& thread : threads) thread.join();
+
+  if (error) std::rethrow_exception(error);
+}
+
+/*! Run `task(i)` for all `0 <= i < num_tasks` on up to `num_threads` threads.
+ *
+ * Tasks are handed out one at a time in increasing order, so uneven tasks are balanced over threads. The calling
+ * thread takes part in the work, and no thread is started for a single thread or a single task.
+ *
+ * If a task throws, no further task is started and the first exception is rethrown once all threads are done.
+ *
+ * \param num_tasks number of tasks.
+ * \param num_threads number of threads, 0 for all hardware threads.
+ * \param task callable taking the task index.
+ */
+template <typename F>
+void parallelFor(const size_t num_tasks, const unsigned num_threads, F&& task)
+{
+  const size_t n = std::min(static_cast<size_t>(numThreads(num_threads)), num_tasks);
+
+  if (n <= 1) {
+    for (size_t i = 0; i < num_tasks; ++i) task(i);
+    return;
+  }
+
+  std::atomic<size_t> next_task(0);
+  runThreads(
+      n,
+      [&](size_t) {
+        for (size_t i = next_task++; i < num_tasks; i = next_task++) task(i);
+      },
+      [&]() { next_task = num_tasks; });
+}
+
+/*! Run `task(i)` for all `0 <= i < num_tasks` on up to `num_threads` threads, each on a fixed range of tasks.
+ *
+ * Thread t, the calling thread being thread 0, runs tasks `slabBegin(num_tasks, n, t) <= i < slabBegin(num_tasks, n,
+ * t + 1)` in increasing order, n being the number of threads. Unlike `parallelFor`, which thread runs a task only
+ * depends on `num_tasks` and `num_threads`, e.g. so that pages first written by a thread in one call are read by the
+ * same thread in another call. Tasks are not balanced over threads.
+ *
+ * If a task throws, the other threads stop after their current task and the first exception is rethrown once all
+ * threads are done.
+ *
+ * \param num_tasks number of tasks.
+ * \param num_threads number of threads, 0 for all hardware threads.
+ * \param task callable taking the task index.
+ */
+template <typename F>
+void parallelForStatic(const size_t num_tasks, const unsigned num_threads, F&& task)
+{
+  const size_t n = std::min(static_cast<size_t>(numThreads(num_threads)), num_tasks);
+
+  if (n <= 1) {
+    for (size_t i = 0; i < num_tasks; ++i) task(i);
+    return;
+  }
+
+  std::atomic<bool> stopped(false);
+  runThreads(
+      n,
+      [&](const size_t t) {
+        for (size_t i = slabBegin(num_tasks, n, t); i < slabBegin(num_tasks, n, t + 1) && !stopped; ++i) task(i);
+      },
+      [&]() { stopped = true; });
+}
+}  // namespace SCALAR_POLYGONIZATION
@@ -0,0 +1,143 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright 2019 Lakshman Anumolu.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "scalar_polygonization/parallel.h"
+#include "scalar_polygonization/polygonize_volume.h"
+#include "scalar_polygonization/vec3.h"
+
+#include <functional>
+
+namespace SCALAR_POLYGONIZATION
+{
+/*! Callback filling node plane `k` of a volume: `values[i + nx * j]` receives the value of node (i, j, k).
+ *
+ * With several threads, different planes are sampled concurrently.
+ */
+template <typename T>
+using PlaneSampler = std::function<void(const int k, T* values)>;
+
+/*! Polygonize a volume whose nodes are sampled one plane at a time, without ever storing the whole volume.
+ *
+ * Each slab of `polygonizeVolume` keeps two node planes, sampled in increasing k as it marches. Node planes shared
+ * by two slabs are sampled by both. The mesh is the same as for a `ScalarVolume` holding the sampled values, and
+ * too many vertices throw `std::overflow_error` as there.
+ *
+ * With `Extraction::COUNT_THEN_FILL`, every plane is sampled twice, once to count and once to fill the mesh, since
+ * keeping the sampled planes between the passes would take the memory of the whole volume.
+ *
+ * \param sample_plane fills a node plane.
+ * \param dims number of nodes along x, y, z.
+ * \param origin position of node (0, 0, 0).
+ * \param spacing distance between two consecutive nodes along x, y, z.
+ * \param iso_alpha value for which iso-surface needs to be extracted.
+ * \param options extraction options.
+ *
+ * \return indexed triangle mesh.
+ */
+template <typename T>
+IndexedMesh<T> polygonizePlanes(const PlaneSampler<T>& sample_plane, const Vec3<int>& dims, const Vec3<T>& origin,
+                                const Vec3<T>& spacing, const T iso_alpha,
+                                const PolygonizeOptions& options = PolygonizeOptions());
+
+/*! Polygonize an implicit function sampled at the nodes of a uniform grid.
+ *
+ * The function is evaluated lazily, one node plane at a time, while marching (see `polygonizePlanes`), so no array
+ * of the size of the grid is allocated. Vertex normals are computed from triangles as in `polygonizeVolume`.
+ *
+ * The function is evaluated once per node, twice with `Extraction::COUNT_THEN_FILL` (see `polygonizePlanes`).
+ *
+ * \param function callable `T function(T x, T y, T z)`, safe to call concurrently.
+ * \param dims number of nodes along x, y, z.
+ * \param origin position of node (0, 0, 0).
+ * \param spacing distance between two consecutive nodes along x, y, z.
+ * \param iso_alpha value for which iso-surface needs to be extracted.
+ * \param options extraction options.
+ *
+ * \return indexed triangle mesh.
+ */
+template <typename T, typename F>
+IndexedMesh<T> polygonizeFunction(const F& function, const Vec3<int>& dims, const Vec3<T>& origin,
+                                  const Vec3<T>& spacing, const T iso_alpha,
+                                  const PolygonizeOptions& options = PolygonizeOptions())
+{
+  const PlaneSampler<T> sample_plane = [&](const int k, T* values) {
+    const T z = origin[2] + k * spacing[2];
+    for (int j = 0; j < dims[1]; ++j) {
+      const T y = origin[1] + j * spacing[1];
+      T* row = values + static_cast<size_t>(j) * dims[0];
+      for (int i = 0; i < dims[0]; ++i) row[i] = function(origin[0] + i * spacing[0], y, z);
+    }
+  };
+
+  return polygonizePlanes(sample_plane, dims, origin, spacing, iso_alpha, options);
+}
+
+/*! Polygonize an implicit function with an analytic gradient.
+ *
+ * Same as above, but vertex normals are the normalized negated gradient at each vertex, i.e. they point towards
+ * decreasing values like the triangles. Normals are not computed from triangles, `options.normal_weighting` is
+ * ignored.
+ *
+ * \param function callable `T function(T x, T y, T z)`, safe to call concurrently.
+ * \param gradient callable `Vec3<T> gradient(T x, T y, T z)`, safe to call concurrently.
+ * \param dims number of nodes along x, y, z.
+ * \param origin position of node (0, 0, 0).
+ * \param spacing distance between two consecutive nodes along x, y, z.
+ * \param iso_alpha value for which iso-surface needs to be extracted.
+ * \param options extraction options.
+ *
+ * \return indexed triangle mesh.
+ */
+template <typename T, typename F, typename G>
+IndexedMesh<T> polygonizeFunction(const F& function, const G& gradient, const Vec3<int>& dims, const Vec3<T>& origin,
+                                  const Vec3<T>& spacing, const T iso_alpha,
+                                  const PolygonizeOptions& options = PolygonizeOptions())
+{
+  PolygonizeOptions mesh_options = options;
+  mesh_options.normal_weighting = NormalWeighting::NONE;
+  auto mesh = polygonizeFunction(function, dims, origin, spacing, iso_alpha, mesh_options);
+
+  mesh.normals.resize(mesh.numVertices());
+  const size_t chunk = 4096;
+  parallelFor((mesh.numVertices() + chunk - 1) / chunk, options.num_threads, [&](const size_t c) {
+    const size_t end = std::min(mesh.numVertices(), (c + 1) * chunk);
+    for (size_t v = c * chunk; v < end; ++v) {
+      const auto& p = mesh.positions[v];
+      mesh.normals[v] = gradient(p[0], p[1], p[2]) * static_cast<T>(-1.);
+      mesh.normals[v].normalize();
+    }
+  });
+
+  return mesh;
+}
+}  // namespace SCALAR_POLYGONIZATION
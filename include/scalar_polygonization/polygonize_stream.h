@@ -0,0 +1,72 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright 2019 Lakshman Anumolu.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "scalar_polygonization/polygonize_function.h"
+#include "scalar_polygonization/vec3.h"
+
+#include <stdint.h>
+#include <functional>
+#include <vector>
+
+namespace SCALAR_POLYGONIZATION
+{
+/*! Callback receiving the mesh of `polygonizeStream` one layer of cubes at a time.
+ *
+ * `positions` are the vertices created by the layer, numbered after the vertices of all previous layers. `indices`
+ * are vertex indices of the triangles of the layer, three per triangle, which may refer to vertices of the previous
+ * layer. Indices are 64 bit, as a streamed volume may have more than 2^32 vertices. Both vectors are reused for the
+ * next layer once the callback returns.
+ */
+template <typename T>
+using MeshSink = std::function<void(const std::vector<Vec3<T>>& positions, const std::vector<uint64_t>& indices)>;
+
+/*! Polygonize a volume streamed one node plane at a time, e.g. from a file larger than memory.
+ *
+ * Node planes are read in increasing k, each exactly once, and triangles are handed to `sink` as soon as their
+ * layer of cubes is marched. Only two node planes and the vertex indices on their edges are kept, so memory is
+ * proportional to a plane, not to the volume or the mesh. Vertices and triangles are the same, in the same order,
+ * as from a single threaded `polygonizeVolume` on the whole volume. Vertex normals are not computed.
+ *
+ * Throws `std::overflow_error` if a single layer of cubes has 2^31 - 1 vertices or more.
+ *
+ * \param read_plane fills node plane k, called for k = 0, 1, ..., dims[2] - 1 in turn.
+ * \param dims number of nodes along x, y, z.
+ * \param origin position of node (0, 0, 0).
+ * \param spacing distance between two consecutive nodes along x, y, z.
+ * \param iso_alpha value for which iso-surface needs to be extracted.
+ * \param sink receives vertices and triangles of each layer of cubes that has some.
+ */
+template <typename T>
+void polygonizeStream(const PlaneSampler<T>& read_plane, const Vec3<int>& dims, const Vec3<T>& origin,
+                      const Vec3<T>& spacing, const T iso_alpha, const MeshSink<T>& sink);
+}  // namespace SCALAR_POLYGONIZATION
@@ -0,0 +1,306 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright 2019 Lakshman Anumolu.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "scalar_polygonization/vec3.h"
+
+#include <stdint.h>
+#include <vector>
+
+namespace SCALAR_POLYGONIZATION
+{
+/*!
+ * \class ScalarVolume
+ *
+ * Non-owning view of a scalar field sampled at the nodes of a uniform grid.
+ *
+ * Node (i, j, k), with `-ghost <= i < dims[0] + ghost` (similarly for j, k), is stored at
+ *
+ *     data[(i + ghost) * strides[0] + (j + ghost) * strides[1] + (k + ghost) * strides[2]]
+ *
+ * and is located at `origin + (i, j, k) * spacing`. Only the `dims` interior nodes are polygonized, ghost nodes are
+ * available for stencils (e.g. gradients) near the boundary. Strides are in number of elements, which allows
+ * polygonizing a sub-block of a larger solver array in place.
+ *
+ * Node values are stored as S, which may differ from the type T of positions and iso-values: volumes of `uint8_t`,
+ * `uint16_t` or `_Float16` values (e.g. quantized archives) are polygonized without converting them, the iso-value
+ * being mapped to S for classification (see `classificationThreshold`). Iso-values are then given in units of the
+ * stored values.
+ */
+template <typename T, typename S = T>
+class ScalarVolume
+{
+ public:
+  using value_type = S;
+
+  /*! Constructor for a strided buffer with ghost layers.
+   *
+   * \param data pointer to the first stored element, i.e. node (-ghost, -ghost, -ghost).
+   * \param dims number of interior nodes along x, y, z.
+   * \param strides distance, in elements, between two consecutive nodes along x, y, z.
+   * \param ghost number of ghost layers on each side.
+   * \param origin position of node (0, 0, 0).
+   * \param spacing distance between two consecutive nodes along x, y, z.
+   */
+  ScalarVolume(const S* data, const Vec3<int>& dims, const Vec3<size_t>& strides, const int ghost,
+               const Vec3<T>& origin, const Vec3<T>& spacing);
+
+  /*! Constructor for a contiguous buffer (x fastest) without ghost layers.
+   *
+   * \param data pointer to node (0, 0, 0).
+   * \param dims number of nodes along x, y, z.
+   * \param origin position of node (0, 0, 0).
+   * \param spacing distance between two consecutive nodes along x, y, z.
+   */
+  ScalarVolume(const S* data, const Vec3<int>& dims, const Vec3<T>& origin, const Vec3<T>& spacing);
+
+  /*! Returns pointer to the first stored element, i.e. node (-ghost, -ghost, -ghost).
+   */
+  const S* data() const { return m_data; }
+
+  /*! Returns number of interior nodes along x, y, z.
+   */
+  const Vec3<int> dims() const { return Vec3<int>(m_dims[0], m_dims[1], m_dims[2]); }
+
+  /*! Returns number of interior nodes along an axis.
+   *
+   * \param axis 0, 1, 2 for x, y, z.
+   */
+  int dim(const int axis) const { return m_dims[axis]; }
+
+  /*! Returns strides along x, y, z in number of elements.
+   */
+  const Vec3<size_t> strides() const { return Vec3<size_t>(m_strides[0], m_strides[1], m_strides[2]); }
+
+  /*! Returns stride along an axis in number of elements.
+   *
+   * \param axis 0, 1, 2 for x, y, z.
+   */
+  size_t stride(const int axis) const { return m_strides[axis]; }
+
+  /*! Returns number of ghost layers on each side.
+   */
+  int ghost() const { return m_ghost; }
+
+  /*! Returns position of node (0, 0, 0).
+   */
+  const Vec3<T> origin() const { return Vec3<T>(m_origin[0], m_origin[1], m_origin[2]); }
+
+  /*! Returns distance between two consecutive nodes along x, y, z.
+   */
+  const Vec3<T> spacing() const { return Vec3<T>(m_spacing[0], m_spacing[1], m_spacing[2]); }
+
+  /*! Offset of node (i, j, k) from `data()`.
+   *
+   * \param i index along x-direction.
+   * \param j index along y-direction.
+   * \param k index along z-direction.
+   *
+   * \return offset in number of elements.
+   */
+  size_t offset(const int i, const int j, const int k) const
+  {
+    return static_cast<size_t>(i + m_ghost) * m_strides[0] + static_cast<size_t>(j + m_ghost) * m_strides[1] +
+           static_cast<size_t>(k + m_ghost) * m_strides[2];
+  }
+
+  /*! Value at node (i, j, k).
+   *
+   * \param i index along x-direction.
+   * \param j index along y-direction.
+   * \param k index along z-direction.
+   *
+   * \return scalar value.
+   */
+  const S& operator()(const int i, const int j, const int k) const { return m_data[this->offset(i, j, k)]; }
+
+  /*! Position of a point given in (possibly fractional) node coordinates.
+   *
+   * \param x coordinate along x-direction, in units of nodes.
+   * \param y coordinate along y-direction, in units of nodes.
+   * \param z coordinate along z-direction, in units of nodes.
+   *
+   * \return position vector.
+   */
+  const Vec3<T> position(const T x, const T y, const T z) const
+  {
+    return Vec3<T>(m_origin[0] + x * m_spacing[0], m_origin[1] + y * m_spacing[1], m_origin[2] + z * m_spacing[2]);
+  }
+
+ private:
+  const S* m_data;
+  int m_dims[3];
+  size_t m_strides[3];
+  int m_ghost;
+  T m_origin[3];
+  T m_spacing[3];
+};
+
+/*!
+ * \class IndexedMesh
+ *
+ * Triangle mesh with shared vertices, as separate arrays of positions, normals and indices. Triangle `t` is made of
+ * vertices `indices[3 * t + 0, 1, 2]`. Indices are 32 bit, `I = uint64_t` holds meshes of more than 2^32 vertices.
+ *
+ * Extractors fill `edges` and `weights` on request (`PolygonizeOptions::vertex_edges`): the grid edge each vertex
+ * lies on and its position along the edge, as found by marching cubes, e.g. for `compressMesh`.
+ */
+template <typename T, typename I = uint32_t>
+class IndexedMesh
+{
+ public:
+  using index_type = I;
+
+  /*! Returns number of vertices.
+   */
+  size_t numVertices() const { return positions.size(); }
+
+  /*! Returns number of triangles.
+   */
+  size_t numTriangles() const { return indices.size() / 3; }
+
+  /*! Remove all vertices and triangles.
+   */
+  void clear();
+
+  std::vector<Vec3<T>> positions;  //!< Position of each vertex.
+  std::vector<Vec3<T>> normals;    //!< Unit normal at each vertex.
+  std::vector<I> indices;          //!< Vertex indices of triangles, three per triangle.
+
+  //! Grid edge of each vertex, `axis + 3 * (i + nx * (j + ny * k))` for the edge from node (i, j, k) along `axis`.
+  std::vector<uint64_t> edges;
+  //! Position of each vertex along its grid edge, from 0 at node (i, j, k) to 1 at the next node along `axis`.
+  std::vector<T> weights;
+};
+
+/*! Weighting of triangle normals averaged into vertex normals.
+ */
+enum class NormalWeighting {
+  AREA,  //!< Triangle normals weighted by the area of the triangle.
+  ANGLE,  //!< Unit triangle normals weighted by the angle of the triangle at the vertex.
+  NONE    //!< Vertex normals are not computed, `normals` is left empty.
+};
+
+/*!
+ * \class PolygonizeOptions
+ *
+ * Options of `polygonizeVolume`.
+ */
+class PolygonizeOptions
+{
+ public:
+  /*! How output arrays of the mesh are filled.
+   */
+  enum class Extraction {
+    SINGLE_PASS,     //!< Append vertices and triangles while marching, then concatenate slabs.
+    COUNT_THEN_FILL  //!< Count vertices and triangles of each slab first, then march into exact size arrays.
+  };
+
+  PolygonizeOptions()
+      : num_threads(1), extraction(Extraction::SINGLE_PASS), normal_weighting(NormalWeighting::AREA),
+        vertex_edges(false)
+  {
+  }
+
+  /*! Number of threads, 0 for all hardware threads.
+   *
+   * The volume is split into slabs of cube layers along z which are polygonized concurrently and stitched along
+   * shared node planes. The result does not depend on the number of threads.
+   */
+  unsigned num_threads;
+
+  /*! Extraction mode.
+   *
+   * `COUNT_THEN_FILL` classifies the volume twice, in exchange the mesh is allocated once and no slab holds a copy
+   * of its part, halving peak memory for large meshes. Both modes return the same mesh.
+   */
+  Extraction extraction;
+
+  /*! Weighting of triangle normals in vertex normals, see `computeVertexNormals`.
+   */
+  NormalWeighting normal_weighting;
+
+  /*! Also fill `IndexedMesh::edges` and `IndexedMesh::weights`.
+   */
+  bool vertex_edges;
+};
+
+/*! Compute vertex normals of a mesh as the normalized sum of weighted normals of triangles sharing each vertex.
+ *
+ * Triangles are split into fixed size chunks, each summing its normals over the range of vertices it uses. Vertices
+ * are then gathered in blocks from the chunks overlapping them, and normalized with SSE. Vertices of a mesh from
+ * marching cubes are created in the order they are used, so chunk ranges are short and hardly overlap. Sums are done
+ * in the same order for any number of threads, so normals do not depend on it.
+ *
+ * \param mesh mesh whose `normals` are overwritten.
+ * \param weighting weighting of triangle normals, `NONE` clears `normals`.
+ * \param num_threads number of threads, 0 for all hardware threads.
+ */
+template <typename T, typename I>
+void computeVertexNormals(IndexedMesh<T, I>& mesh, const NormalWeighting weighting = NormalWeighting::AREA,
+                          const unsigned num_threads = 1);
+
+/*! Polygonize a scalar volume with marching cubes.
+ *
+ * Every intersection of the iso-surface with a grid edge becomes exactly one vertex of the returned mesh. Triangles
+ * face towards decreasing scalar values, vertex normals are the average of weighted normals of triangles sharing
+ * the vertex (see `PolygonizeOptions::normal_weighting`).
+ *
+ * Indices are 32 bit: a mesh of more than 2^32 vertices, a slab (see `PolygonizeOptions::num_threads`) above the
+ * first one of more than 2^31 vertices, or node planes of more than 2^31 / 3 nodes with several slabs throw
+ * `std::overflow_error`. Use `polygonizeStream` for larger surfaces.
+ *
+ * \param volume scalar field to polygonize.
+ * \param iso_alpha value for which iso-surface needs to be extracted.
+ * \param options extraction options.
+ *
+ * \return indexed triangle mesh.
+ */
+template <typename T, typename S>
+IndexedMesh<T> polygonizeVolume(const ScalarVolume<T, S>& volume, const T iso_alpha,
+                                const PolygonizeOptions& options = PolygonizeOptions());
+
+/*! Polygonize a scalar volume with marching cubes for several iso-values in one pass.
+ *
+ * The volume is traversed once, each row of nodes is classified and its cubes marched for all iso-values while it
+ * is in cache. This is faster than one `polygonizeVolume` call per iso-value when reading the volume dominates.
+ *
+ * \param volume scalar field to polygonize.
+ * \param iso_alphas values for which iso-surfaces need to be extracted.
+ * \param options extraction options.
+ *
+ * \return one mesh per iso-value, each the same as from `polygonizeVolume(volume, iso_alpha, options)`.
+ */
+template <typename T, typename S>
+std::vector<IndexedMesh<T>> polygonizeVolume(const ScalarVolume<T, S>& volume, const std::vector<T>& iso_alphas,
+                                             const PolygonizeOptions& options = PolygonizeOptions());
+}  // namespace SCALAR_POLYGONIZATION
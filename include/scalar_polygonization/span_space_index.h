@@ -0,0 +1,130 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright 2019 Lakshman Anumolu.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "scalar_polygonization/brick_min_max.h"
+#include "scalar_polygonization/polygonize_volume.h"
+
+#include <stdint.h>
+#include <vector>
+
+namespace SCALAR_POLYGONIZATION
+{
+/*!
+ * \class SpanSpaceIndex
+ *
+ * Interval tree over value ranges of bricks, to find bricks intersected by an iso-surface without visiting others.
+ *
+ * Built once per field from its `BrickMinMax`, a query for `iso_alpha` costs O(log(number of bricks) + number of
+ * bricks found). Bricks of constant value can never be intersected and are left out. Brick (bi, bj, bk) is numbered
+ * `bi + numBricks(0) * (bj + numBricks(1) * bk)`.
+ */
+template <typename T>
+class SpanSpaceIndex
+{
+ public:
+  /*! Constructor.
+   *
+   * \param bricks value ranges of bricks of the field.
+   */
+  explicit SpanSpaceIndex(const BrickMinMax<T>& bricks);
+
+  /*! Returns number of nodes along x, y, z of the field the index was built for.
+   */
+  const Vec3<int> dims() const { return Vec3<int>(m_dims[0], m_dims[1], m_dims[2]); }
+
+  /*! Returns number of bricks along an axis.
+   *
+   * \param axis 0, 1, 2 for x, y, z.
+   */
+  int numBricks(const int axis) const { return m_num_bricks[axis]; }
+
+  /*! Returns number of bricks in the index, i.e. bricks of non constant value.
+   */
+  size_t numIntervals() const { return m_by_min.size(); }
+
+  /*! Bricks that may be intersected by an iso-surface, i.e. with `min < iso_alpha <= max`.
+   *
+   * \param iso_alpha value for which iso-surface needs to be extracted.
+   * \param bricks output, brick numbers in increasing order.
+   */
+  void query(const T iso_alpha, std::vector<uint32_t>& bricks) const;
+
+ private:
+  //! Value range of a brick.
+  struct Interval {
+    T min;
+    T max;
+    uint32_t brick;
+  };
+
+  /*! Node of the tree, holding intervals that contain its center.
+   *
+   * Intervals ending before the center are in the left subtree, intervals starting at or after it in the right one.
+   */
+  struct Node {
+    T center;
+    size_t begin;  //!< First interval of the node in `m_by_min` and `m_by_max`.
+    size_t end;    //!< One past the last interval of the node.
+    int left;      //!< Index of the left child, -1 if none.
+    int right;     //!< Index of the right child, -1 if none.
+  };
+
+  int build(std::vector<Interval>& intervals);
+
+  int m_dims[3];
+  int m_num_bricks[3];
+  std::vector<Node> m_nodes;
+  std::vector<Interval> m_by_min;  //!< Intervals of each node by increasing minimum.
+  std::vector<Interval> m_by_max;  //!< Intervals of each node by decreasing maximum.
+};
+
+/*! Polygonize the bricks of a scalar volume found by a span space index.
+ *
+ * Only cubes of bricks returned by `index.query(iso_alpha)` are visited, so the cost depends on the size of the
+ * surface and not of the volume. Bricks are polygonized concurrently, each grid edge belongs to one brick which
+ * creates its vertex, neighbouring bricks refer to it. The mesh is the same as the one of `polygonizeVolume` up to
+ * the order of vertices and triangles, and rounding of vertex positions on faces between bricks. A mesh of more than
+ * 2^32 vertices throws `std::overflow_error`.
+ *
+ * \param volume scalar field to polygonize.
+ * \param index span space index built from up to date brick ranges of `volume`. An index built for a volume of other
+ *        dimensions throws `std::invalid_argument`.
+ * \param iso_alpha value for which iso-surface needs to be extracted.
+ * \param options extraction options, `extraction` is ignored.
+ *
+ * \return indexed triangle mesh.
+ */
+template <typename T>
+IndexedMesh<T> polygonizeVolume(const ScalarVolume<T>& volume, const SpanSpaceIndex<T>& index, const T iso_alpha,
+                                const PolygonizeOptions& options = PolygonizeOptions());
+}  // namespace SCALAR_POLYGONIZATION
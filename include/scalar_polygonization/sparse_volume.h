@@ -0,0 +1,180 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright 2019 Lakshman Anumolu.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "scalar_polygonization/polygonize_volume.h"
+#include "scalar_polygonization/vec3.h"
+
+#include <stdint.h>
+#include <vector>
+
+namespace SCALAR_POLYGONIZATION
+{
+/*!
+ * \class SparseVolume
+ *
+ * Scalar field sampled at the nodes of a uniform grid, stored only in bricks of `BRICK_SIZE`^3 nodes near the
+ * iso-surface, e.g. the narrow band of a level set.
+ *
+ * Brick (bi, bj, bk) holds nodes `BRICK_SIZE * (bi, bj, bk)` to `BRICK_SIZE * (bi + 1, bj + 1, bk + 1) - 1`. A table
+ * over all bricks gives for each either its allocated values, x fastest, or a constant tile value shared by all its
+ * nodes (initially `background`). Tiles carry the side of the surface away from the band, e.g. a negative value
+ * inside and a positive one outside of a level set, at 8 bytes per brick instead of `BRICK_SIZE`^3 values.
+ */
+template <typename T>
+class SparseVolume
+{
+ public:
+  static constexpr int BRICK_SIZE = 8;                                     //!< Number of nodes along a brick side.
+  static constexpr int BRICK_NODES = BRICK_SIZE * BRICK_SIZE * BRICK_SIZE;  //!< Number of nodes of a brick.
+
+  /*! Constructor, all bricks are tiles of value `background`.
+   *
+   * \param dims number of nodes along x, y, z.
+   * \param origin position of node (0, 0, 0).
+   * \param spacing distance between two consecutive nodes along x, y, z.
+   * \param background value of all nodes.
+   */
+  SparseVolume(const Vec3<int>& dims, const Vec3<T>& origin, const Vec3<T>& spacing, const T background);
+
+  /*! Returns number of nodes along x, y, z.
+   */
+  const Vec3<int> dims() const { return Vec3<int>(m_dims[0], m_dims[1], m_dims[2]); }
+
+  /*! Returns number of nodes along an axis.
+   *
+   * \param axis 0, 1, 2 for x, y, z.
+   */
+  int dim(const int axis) const { return m_dims[axis]; }
+
+  /*! Returns number of bricks along an axis.
+   *
+   * \param axis 0, 1, 2 for x, y, z.
+   */
+  int numBricks(const int axis) const { return m_num_bricks[axis]; }
+
+  /*! Returns number of allocated bricks.
+   */
+  size_t numAllocatedBricks() const { return m_values.size() / BRICK_NODES - m_free_bricks.size(); }
+
+  /*! Returns value at node (i, j, k).
+   *
+   * \param i index along x-direction.
+   * \param j index along y-direction.
+   * \param k index along z-direction.
+   */
+  T value(const int i, const int j, const int k) const;
+
+  /*! Set value at node (i, j, k), allocating its brick if it is a tile.
+   *
+   * \param i index along x-direction.
+   * \param j index along y-direction.
+   * \param k index along z-direction.
+   * \param value new value.
+   */
+  void setValue(const int i, const int j, const int k, const T value);
+
+  /*! Returns values of brick (bi, bj, bk), x fastest, or null if it is a tile.
+   *
+   * Pointers are valid until the next allocation of a brick.
+   */
+  const T* brick(const int bi, const int bj, const int bk) const;
+
+  /*! Allocate brick (bi, bj, bk), with all values set to its tile value, unless already allocated.
+   *
+   * \return values of the brick, x fastest, valid until the next allocation of a brick.
+   */
+  T* allocateBrick(const int bi, const int bj, const int bk);
+
+  /*! Returns tile value of brick (bi, bj, bk), meaningful if it is not allocated.
+   */
+  T tileValue(const int bi, const int bj, const int bk) const { return m_tiles[this->brickIndex(bi, bj, bk)]; }
+
+  /*! Make brick (bi, bj, bk) a tile of a single value, releasing its values if allocated.
+   *
+   * \param bi index of the brick along x-direction.
+   * \param bj index of the brick along y-direction.
+   * \param bk index of the brick along z-direction.
+   * \param value value of all nodes of the brick.
+   */
+  void setTile(const int bi, const int bj, const int bk, const T value);
+
+  /*! Position of a point given in (possibly fractional) node coordinates.
+   *
+   * \param x coordinate along x-direction, in units of nodes.
+   * \param y coordinate along y-direction, in units of nodes.
+   * \param z coordinate along z-direction, in units of nodes.
+   *
+   * \return position vector.
+   */
+  const Vec3<T> position(const T x, const T y, const T z) const
+  {
+    return Vec3<T>(m_origin[0] + x * m_spacing[0], m_origin[1] + y * m_spacing[1], m_origin[2] + z * m_spacing[2]);
+  }
+
+ private:
+  static constexpr uint32_t TILE = UINT32_MAX;  //!< Table entry of a brick that is not allocated.
+
+  size_t brickIndex(const int bi, const int bj, const int bk) const
+  {
+    return static_cast<size_t>(bi) + m_num_bricks[0] * (static_cast<size_t>(bj) + m_num_bricks[1] * bk);
+  }
+
+  int m_dims[3];
+  int m_num_bricks[3];
+  T m_origin[3];
+  T m_spacing[3];
+  std::vector<uint32_t> m_table;        //!< Allocated brick number of each brick, or TILE.
+  std::vector<T> m_tiles;               //!< Tile value of each brick.
+  std::vector<T> m_values;              //!< Values of allocated bricks, `BRICK_NODES` per brick.
+  std::vector<uint32_t> m_free_bricks;  //!< Released brick numbers, reused first.
+};
+
+/*! Polygonize a sparse volume with marching cubes, brick by brick.
+ *
+ * Only cubes of bricks that are allocated, or whose +x, +y, +z neighbours are (for cubes on the seams), or whose tile
+ * values with their neighbours differ across `iso_alpha`, are visited, so the cost follows the area of the surface
+ * rather than the size of the grid. Bricks are processed concurrently and concatenated in order, so the mesh does not
+ * depend on the number of threads. Every intersection of the iso-surface with a grid edge becomes exactly one vertex,
+ * at the position from `polygonizeVolume` on the dense field up to rounding, triangles face towards decreasing values.
+ * A mesh of more than 2^32 vertices throws `std::overflow_error`.
+ *
+ * \param volume scalar field to polygonize.
+ * \param iso_alpha value for which iso-surface needs to be extracted.
+ * \param options extraction options, `extraction` is not used.
+ *
+ * \return indexed triangle mesh.
+ */
+template <typename T>
+IndexedMesh<T> polygonizeVolume(const SparseVolume<T>& volume, const T iso_alpha,
+                                const PolygonizeOptions& options = PolygonizeOptions());
+}  // namespace SCALAR_POLYGONIZATION
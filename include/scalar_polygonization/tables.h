@@ -35,25 +35,31 @@
 
 #pragma once
 
+#include <cstdint>
+
 namespace SCALAR_POLYGONIZATION
 {
 // For Convention-1
-static const int edge_id_to_vertex_id_base_map[12] = {0, 1, 3, 0, 4, 5, 7, 4, 0, 1, 2, 3};
-static const int edge_id_to_vertex_id_offset_map[12] = {0, 1, 0, 1, 0, 1, 0, 1, 2, 2, 2, 2};
+static constexpr int edge_id_to_vertex_id_base_map[12] = {0, 1, 3, 0, 4, 5, 7, 4, 0, 1, 2, 3};
+static constexpr int edge_id_to_vertex_id_offset_map[12] = {0, 1, 0, 1, 0, 1, 0, 1, 2, 2, 2, 2};
 
-// For Convention-2 (Ref.: http://paulbourke.net/geometry/polygonise/)
-// static const int edge_id_to_vertex_id_base_map[12] = {0, 1, 3, 0, 4, 5, 7, 4, 0, 1, 2, 3};
-// static const int edge_id_to_vertex_id_offset_map[12] = {0, 2, 0, 2, 0, 2, 0, 2, 1, 1, 1, 1};
+// For Convention-2 (Ref.: http://paulbourke.net/geometry/polygonise/), base map is the same as for Convention-1.
+static constexpr int convention_2_edge_id_to_vertex_id_offset_map[12] = {0, 2, 0, 2, 0, 2, 0, 2, 1, 1, 1, 1};
 
 // These tables are used so that everything can be done in little loops that you can look at all at once
 // rather than in pages and pages of unrolled code.
 // list the positions, relative to vertex0, of each of the 8 vertices of a cube
-static const float vertex_offset[8][3] = {{0.0, 0.0, 0.0}, {1.0, 0.0, 0.0}, {1.0, 1.0, 0.0}, {0.0, 1.0, 0.0},
-                                          {0.0, 0.0, 1.0}, {1.0, 0.0, 1.0}, {1.0, 1.0, 1.0}, {0.0, 1.0, 1.0}};
+static constexpr float vertex_offset[8][3] = {{0.0, 0.0, 0.0}, {1.0, 0.0, 0.0}, {1.0, 1.0, 0.0}, {0.0, 1.0, 0.0},
+                                              {0.0, 0.0, 1.0}, {1.0, 0.0, 1.0}, {1.0, 1.0, 1.0}, {0.0, 1.0, 1.0}};
+
+// Same for Convention-2, i.e. Convention-1 with y and z swapped.
+static constexpr float convention_2_vertex_offset[8][3] = {{0.0, 0.0, 0.0}, {1.0, 0.0, 0.0}, {1.0, 0.0, 1.0},
+                                                           {0.0, 0.0, 1.0}, {0.0, 1.0, 0.0}, {1.0, 1.0, 0.0},
+                                                           {1.0, 1.0, 1.0}, {0.0, 1.0, 1.0}};
 
 // edge_connection lists the index of the endpoint vertices for each of the 12 edges of the cube
-static const int edge_connection[12][2] = {{0, 1}, {1, 2}, {2, 3}, {3, 0}, {4, 5}, {5, 6},
-                                           {6, 7}, {7, 4}, {0, 4}, {1, 5}, {2, 6}, {3, 7}};
+static constexpr int edge_connection[12][2] = {{0, 1}, {1, 2}, {2, 3}, {3, 0}, {4, 5}, {5, 6},
+                                               {6, 7}, {7, 4}, {0, 4}, {1, 5}, {2, 6}, {3, 7}};
 
 // Below arrays are direct copy from http://paulbourke.net/geometry/polygonise/.
 
@@ -346,4 +352,545 @@ static const int triangle_table[256][16] = {{-1, -1, -1, -1, -1, -1, -1, -1, -1,
                                             {0, 9, 1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
                                             {0, 3, 8, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
                                             {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1}};
+
+// Number of triangles of each of the 256 cases, i.e. number of edge triples in triangle_table before -1.
+static constexpr uint8_t triangle_count_table[256] = {
+    0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 2, 1, 2, 2, 3, 2, 3, 3, 4, 2, 3, 3, 4, 3, 4, 4, 3,
+    1, 2, 2, 3, 2, 3, 3, 4, 2, 3, 3, 4, 3, 4, 4, 3, 2, 3, 3, 2, 3, 4, 4, 3, 3, 4, 4, 3, 4, 5, 5, 2,
+    1, 2, 2, 3, 2, 3, 3, 4, 2, 3, 3, 4, 3, 4, 4, 3, 2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 4,
+    2, 3, 3, 4, 3, 4, 2, 3, 3, 4, 4, 5, 4, 5, 3, 2, 3, 4, 4, 3, 4, 5, 3, 2, 4, 5, 5, 4, 5, 2, 4, 1,
+    1, 2, 2, 3, 2, 3, 3, 4, 2, 3, 3, 4, 3, 4, 4, 3, 2, 3, 3, 4, 3, 4, 4, 5, 3, 2, 4, 3, 4, 3, 5, 2,
+    2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 4, 3, 4, 4, 3, 4, 5, 5, 4, 4, 3, 5, 2, 5, 4, 2, 1,
+    2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 2, 3, 3, 2, 3, 4, 4, 5, 4, 5, 5, 2, 4, 3, 5, 4, 3, 2, 4, 1,
+    3, 4, 4, 5, 4, 5, 3, 4, 4, 5, 5, 2, 3, 4, 2, 1, 2, 3, 3, 2, 3, 4, 2, 1, 3, 2, 4, 1, 2, 1, 1, 0};
+
+// Number of edges intersected in each of the 256 cases, i.e. number of bits set in edge_table.
+static constexpr uint8_t case_edge_count[256] = {
+    0, 3, 3, 4, 3, 6, 4, 5, 3, 4, 6, 5, 4, 5, 5, 4, 3, 4, 6, 5, 6, 7, 7, 6, 6, 5, 9, 6, 7, 6, 8, 5,
+    3, 6, 4, 5, 6, 9, 5, 6, 6, 7, 7, 6, 7, 8, 6, 5, 4, 5, 5, 4, 7, 8, 6, 5, 7, 6, 8, 5, 8, 7, 7, 4,
+    3, 6, 6, 7, 4, 7, 5, 6, 6, 7, 9, 8, 5, 6, 6, 5, 6, 7, 9, 8, 7, 8, 8, 7, 9, 8, 12, 9, 8, 7, 9, 6,
+    4, 7, 5, 6, 5, 8, 4, 5, 7, 8, 8, 7, 6, 7, 5, 4, 5, 6, 6, 5, 6, 7, 5, 4, 8, 7, 9, 6, 7, 6, 6, 3,
+    3, 6, 6, 7, 6, 9, 7, 8, 4, 5, 7, 6, 5, 6, 6, 5, 4, 5, 7, 6, 7, 8, 8, 7, 5, 4, 8, 5, 6, 5, 7, 4,
+    6, 9, 7, 8, 9, 12, 8, 9, 7, 8, 8, 7, 8, 9, 7, 6, 5, 6, 6, 5, 8, 9, 7, 6, 6, 5, 7, 4, 7, 6, 6, 3,
+    4, 7, 7, 8, 5, 8, 6, 7, 5, 6, 8, 7, 4, 5, 5, 4, 5, 6, 8, 7, 6, 7, 7, 6, 6, 5, 9, 6, 5, 4, 6, 3,
+    5, 8, 6, 7, 6, 9, 5, 6, 6, 7, 7, 6, 5, 6, 4, 3, 4, 5, 5, 4, 5, 6, 4, 3, 5, 4, 6, 3, 4, 3, 3, 0};
+
+// Intersected edges of each case in increasing order; the first case_edge_count entries are valid.
+static constexpr uint8_t case_edges[256][12] = {
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 3, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 1, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {1, 3, 8, 9, 0, 0, 0, 0, 0, 0, 0, 0},
+    {1, 2, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 1, 2, 3, 8, 10, 0, 0, 0, 0, 0, 0},
+    {0, 2, 9, 10, 0, 0, 0, 0, 0, 0, 0, 0},
+    {2, 3, 8, 9, 10, 0, 0, 0, 0, 0, 0, 0},
+    {2, 3, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 2, 8, 11, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 1, 2, 3, 9, 11, 0, 0, 0, 0, 0, 0},
+    {1, 2, 8, 9, 11, 0, 0, 0, 0, 0, 0, 0},
+    {1, 3, 10, 11, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 1, 8, 10, 11, 0, 0, 0, 0, 0, 0, 0},
+    {0, 3, 9, 10, 11, 0, 0, 0, 0, 0, 0, 0},
+    {8, 9, 10, 11, 0, 0, 0, 0, 0, 0, 0, 0},
+    {4, 7, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 3, 4, 7, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 1, 4, 7, 8, 9, 0, 0, 0, 0, 0, 0},
+    {1, 3, 4, 7, 9, 0, 0, 0, 0, 0, 0, 0},
+    {1, 2, 4, 7, 8, 10, 0, 0, 0, 0, 0, 0},
+    {0, 1, 2, 3, 4, 7, 10, 0, 0, 0, 0, 0},
+    {0, 2, 4, 7, 8, 9, 10, 0, 0, 0, 0, 0},
+    {2, 3, 4, 7, 9, 10, 0, 0, 0, 0, 0, 0},
+    {2, 3, 4, 7, 8, 11, 0, 0, 0, 0, 0, 0},
+    {0, 2, 4, 7, 11, 0, 0, 0, 0, 0, 0, 0},
+    {0, 1, 2, 3, 4, 7, 8, 9, 11, 0, 0, 0},
+    {1, 2, 4, 7, 9, 11, 0, 0, 0, 0, 0, 0},
+    {1, 3, 4, 7, 8, 10, 11, 0, 0, 0, 0, 0},
+    {0, 1, 4, 7, 10, 11, 0, 0, 0, 0, 0, 0},
+    {0, 3, 4, 7, 8, 9, 10, 11, 0, 0, 0, 0},
+    {4, 7, 9, 10, 11, 0, 0, 0, 0, 0, 0, 0},
+    {4, 5, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 3, 4, 5, 8, 9, 0, 0, 0, 0, 0, 0},
+    {0, 1, 4, 5, 0, 0, 0, 0, 0, 0, 0, 0},
+    {1, 3, 4, 5, 8, 0, 0, 0, 0, 0, 0, 0},
+    {1, 2, 4, 5, 9, 10, 0, 0, 0, 0, 0, 0},
+    {0, 1, 2, 3, 4, 5, 8, 9, 10, 0, 0, 0},
+    {0, 2, 4, 5, 10, 0, 0, 0, 0, 0, 0, 0},
+    {2, 3, 4, 5, 8, 10, 0, 0, 0, 0, 0, 0},
+    {2, 3, 4, 5, 9, 11, 0, 0, 0, 0, 0, 0},
+    {0, 2, 4, 5, 8, 9, 11, 0, 0, 0, 0, 0},
+    {0, 1, 2, 3, 4, 5, 11, 0, 0, 0, 0, 0},
+    {1, 2, 4, 5, 8, 11, 0, 0, 0, 0, 0, 0},
+    {1, 3, 4, 5, 9, 10, 11, 0, 0, 0, 0, 0},
+    {0, 1, 4, 5, 8, 9, 10, 11, 0, 0, 0, 0},
+    {0, 3, 4, 5, 10, 11, 0, 0, 0, 0, 0, 0},
+    {4, 5, 8, 10, 11, 0, 0, 0, 0, 0, 0, 0},
+    {5, 7, 8, 9, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 3, 5, 7, 9, 0, 0, 0, 0, 0, 0, 0},
+    {0, 1, 5, 7, 8, 0, 0, 0, 0, 0, 0, 0},
+    {1, 3, 5, 7, 0, 0, 0, 0, 0, 0, 0, 0},
+    {1, 2, 5, 7, 8, 9, 10, 0, 0, 0, 0, 0},
+    {0, 1, 2, 3, 5, 7, 9, 10, 0, 0, 0, 0},
+    {0, 2, 5, 7, 8, 10, 0, 0, 0, 0, 0, 0},
+    {2, 3, 5, 7, 10, 0, 0, 0, 0, 0, 0, 0},
+    {2, 3, 5, 7, 8, 9, 11, 0, 0, 0, 0, 0},
+    {0, 2, 5, 7, 9, 11, 0, 0, 0, 0, 0, 0},
+    {0, 1, 2, 3, 5, 7, 8, 11, 0, 0, 0, 0},
+    {1, 2, 5, 7, 11, 0, 0, 0, 0, 0, 0, 0},
+    {1, 3, 5, 7, 8, 9, 10, 11, 0, 0, 0, 0},
+    {0, 1, 5, 7, 9, 10, 11, 0, 0, 0, 0, 0},
+    {0, 3, 5, 7, 8, 10, 11, 0, 0, 0, 0, 0},
+    {5, 7, 10, 11, 0, 0, 0, 0, 0, 0, 0, 0},
+    {5, 6, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 3, 5, 6, 8, 10, 0, 0, 0, 0, 0, 0},
+    {0, 1, 5, 6, 9, 10, 0, 0, 0, 0, 0, 0},
+    {1, 3, 5, 6, 8, 9, 10, 0, 0, 0, 0, 0},
+    {1, 2, 5, 6, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 1, 2, 3, 5, 6, 8, 0, 0, 0, 0, 0},
+    {0, 2, 5, 6, 9, 0, 0, 0, 0, 0, 0, 0},
+    {2, 3, 5, 6, 8, 9, 0, 0, 0, 0, 0, 0},
+    {2, 3, 5, 6, 10, 11, 0, 0, 0, 0, 0, 0},
+    {0, 2, 5, 6, 8, 10, 11, 0, 0, 0, 0, 0},
+    {0, 1, 2, 3, 5, 6, 9, 10, 11, 0, 0, 0},
+    {1, 2, 5, 6, 8, 9, 10, 11, 0, 0, 0, 0},
+    {1, 3, 5, 6, 11, 0, 0, 0, 0, 0, 0, 0},
+    {0, 1, 5, 6, 8, 11, 0, 0, 0, 0, 0, 0},
+    {0, 3, 5, 6, 9, 11, 0, 0, 0, 0, 0, 0},
+    {5, 6, 8, 9, 11, 0, 0, 0, 0, 0, 0, 0},
+    {4, 5, 6, 7, 8, 10, 0, 0, 0, 0, 0, 0},
+    {0, 3, 4, 5, 6, 7, 10, 0, 0, 0, 0, 0},
+    {0, 1, 4, 5, 6, 7, 8, 9, 10, 0, 0, 0},
+    {1, 3, 4, 5, 6, 7, 9, 10, 0, 0, 0, 0},
+    {1, 2, 4, 5, 6, 7, 8, 0, 0, 0, 0, 0},
+    {0, 1, 2, 3, 4, 5, 6, 7, 0, 0, 0, 0},
+    {0, 2, 4, 5, 6, 7, 8, 9, 0, 0, 0, 0},
+    {2, 3, 4, 5, 6, 7, 9, 0, 0, 0, 0, 0},
+    {2, 3, 4, 5, 6, 7, 8, 10, 11, 0, 0, 0},
+    {0, 2, 4, 5, 6, 7, 10, 11, 0, 0, 0, 0},
+    {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11},
+    {1, 2, 4, 5, 6, 7, 9, 10, 11, 0, 0, 0},
+    {1, 3, 4, 5, 6, 7, 8, 11, 0, 0, 0, 0},
+    {0, 1, 4, 5, 6, 7, 11, 0, 0, 0, 0, 0},
+    {0, 3, 4, 5, 6, 7, 8, 9, 11, 0, 0, 0},
+    {4, 5, 6, 7, 9, 11, 0, 0, 0, 0, 0, 0},
+    {4, 6, 9, 10, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 3, 4, 6, 8, 9, 10, 0, 0, 0, 0, 0},
+    {0, 1, 4, 6, 10, 0, 0, 0, 0, 0, 0, 0},
+    {1, 3, 4, 6, 8, 10, 0, 0, 0, 0, 0, 0},
+    {1, 2, 4, 6, 9, 0, 0, 0, 0, 0, 0, 0},
+    {0, 1, 2, 3, 4, 6, 8, 9, 0, 0, 0, 0},
+    {0, 2, 4, 6, 0, 0, 0, 0, 0, 0, 0, 0},
+    {2, 3, 4, 6, 8, 0, 0, 0, 0, 0, 0, 0},
+    {2, 3, 4, 6, 9, 10, 11, 0, 0, 0, 0, 0},
+    {0, 2, 4, 6, 8, 9, 10, 11, 0, 0, 0, 0},
+    {0, 1, 2, 3, 4, 6, 10, 11, 0, 0, 0, 0},
+    {1, 2, 4, 6, 8, 10, 11, 0, 0, 0, 0, 0},
+    {1, 3, 4, 6, 9, 11, 0, 0, 0, 0, 0, 0},
+    {0, 1, 4, 6, 8, 9, 11, 0, 0, 0, 0, 0},
+    {0, 3, 4, 6, 11, 0, 0, 0, 0, 0, 0, 0},
+    {4, 6, 8, 11, 0, 0, 0, 0, 0, 0, 0, 0},
+    {6, 7, 8, 9, 10, 0, 0, 0, 0, 0, 0, 0},
+    {0, 3, 6, 7, 9, 10, 0, 0, 0, 0, 0, 0},
+    {0, 1, 6, 7, 8, 10, 0, 0, 0, 0, 0, 0},
+    {1, 3, 6, 7, 10, 0, 0, 0, 0, 0, 0, 0},
+    {1, 2, 6, 7, 8, 9, 0, 0, 0, 0, 0, 0},
+    {0, 1, 2, 3, 6, 7, 9, 0, 0, 0, 0, 0},
+    {0, 2, 6, 7, 8, 0, 0, 0, 0, 0, 0, 0},
+    {2, 3, 6, 7, 0, 0, 0, 0, 0, 0, 0, 0},
+    {2, 3, 6, 7, 8, 9, 10, 11, 0, 0, 0, 0},
+    {0, 2, 6, 7, 9, 10, 11, 0, 0, 0, 0, 0},
+    {0, 1, 2, 3, 6, 7, 8, 10, 11, 0, 0, 0},
+    {1, 2, 6, 7, 10, 11, 0, 0, 0, 0, 0, 0},
+    {1, 3, 6, 7, 8, 9, 11, 0, 0, 0, 0, 0},
+    {0, 1, 6, 7, 9, 11, 0, 0, 0, 0, 0, 0},
+    {0, 3, 6, 7, 8, 11, 0, 0, 0, 0, 0, 0},
+    {6, 7, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {6, 7, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 3, 6, 7, 8, 11, 0, 0, 0, 0, 0, 0},
+    {0, 1, 6, 7, 9, 11, 0, 0, 0, 0, 0, 0},
+    {1, 3, 6, 7, 8, 9, 11, 0, 0, 0, 0, 0},
+    {1, 2, 6, 7, 10, 11, 0, 0, 0, 0, 0, 0},
+    {0, 1, 2, 3, 6, 7, 8, 10, 11, 0, 0, 0},
+    {0, 2, 6, 7, 9, 10, 11, 0, 0, 0, 0, 0},
+    {2, 3, 6, 7, 8, 9, 10, 11, 0, 0, 0, 0},
+    {2, 3, 6, 7, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 2, 6, 7, 8, 0, 0, 0, 0, 0, 0, 0},
+    {0, 1, 2, 3, 6, 7, 9, 0, 0, 0, 0, 0},
+    {1, 2, 6, 7, 8, 9, 0, 0, 0, 0, 0, 0},
+    {1, 3, 6, 7, 10, 0, 0, 0, 0, 0, 0, 0},
+    {0, 1, 6, 7, 8, 10, 0, 0, 0, 0, 0, 0},
+    {0, 3, 6, 7, 9, 10, 0, 0, 0, 0, 0, 0},
+    {6, 7, 8, 9, 10, 0, 0, 0, 0, 0, 0, 0},
+    {4, 6, 8, 11, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 3, 4, 6, 11, 0, 0, 0, 0, 0, 0, 0},
+    {0, 1, 4, 6, 8, 9, 11, 0, 0, 0, 0, 0},
+    {1, 3, 4, 6, 9, 11, 0, 0, 0, 0, 0, 0},
+    {1, 2, 4, 6, 8, 10, 11, 0, 0, 0, 0, 0},
+    {0, 1, 2, 3, 4, 6, 10, 11, 0, 0, 0, 0},
+    {0, 2, 4, 6, 8, 9, 10, 11, 0, 0, 0, 0},
+    {2, 3, 4, 6, 9, 10, 11, 0, 0, 0, 0, 0},
+    {2, 3, 4, 6, 8, 0, 0, 0, 0, 0, 0, 0},
+    {0, 2, 4, 6, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 1, 2, 3, 4, 6, 8, 9, 0, 0, 0, 0},
+    {1, 2, 4, 6, 9, 0, 0, 0, 0, 0, 0, 0},
+    {1, 3, 4, 6, 8, 10, 0, 0, 0, 0, 0, 0},
+    {0, 1, 4, 6, 10, 0, 0, 0, 0, 0, 0, 0},
+    {0, 3, 4, 6, 8, 9, 10, 0, 0, 0, 0, 0},
+    {4, 6, 9, 10, 0, 0, 0, 0, 0, 0, 0, 0},
+    {4, 5, 6, 7, 9, 11, 0, 0, 0, 0, 0, 0},
+    {0, 3, 4, 5, 6, 7, 8, 9, 11, 0, 0, 0},
+    {0, 1, 4, 5, 6, 7, 11, 0, 0, 0, 0, 0},
+    {1, 3, 4, 5, 6, 7, 8, 11, 0, 0, 0, 0},
+    {1, 2, 4, 5, 6, 7, 9, 10, 11, 0, 0, 0},
+    {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11},
+    {0, 2, 4, 5, 6, 7, 10, 11, 0, 0, 0, 0},
+    {2, 3, 4, 5, 6, 7, 8, 10, 11, 0, 0, 0},
+    {2, 3, 4, 5, 6, 7, 9, 0, 0, 0, 0, 0},
+    {0, 2, 4, 5, 6, 7, 8, 9, 0, 0, 0, 0},
+    {0, 1, 2, 3, 4, 5, 6, 7, 0, 0, 0, 0},
+    {1, 2, 4, 5, 6, 7, 8, 0, 0, 0, 0, 0},
+    {1, 3, 4, 5, 6, 7, 9, 10, 0, 0, 0, 0},
+    {0, 1, 4, 5, 6, 7, 8, 9, 10, 0, 0, 0},
+    {0, 3, 4, 5, 6, 7, 10, 0, 0, 0, 0, 0},
+    {4, 5, 6, 7, 8, 10, 0, 0, 0, 0, 0, 0},
+    {5, 6, 8, 9, 11, 0, 0, 0, 0, 0, 0, 0},
+    {0, 3, 5, 6, 9, 11, 0, 0, 0, 0, 0, 0},
+    {0, 1, 5, 6, 8, 11, 0, 0, 0, 0, 0, 0},
+    {1, 3, 5, 6, 11, 0, 0, 0, 0, 0, 0, 0},
+    {1, 2, 5, 6, 8, 9, 10, 11, 0, 0, 0, 0},
+    {0, 1, 2, 3, 5, 6, 9, 10, 11, 0, 0, 0},
+    {0, 2, 5, 6, 8, 10, 11, 0, 0, 0, 0, 0},
+    {2, 3, 5, 6, 10, 11, 0, 0, 0, 0, 0, 0},
+    {2, 3, 5, 6, 8, 9, 0, 0, 0, 0, 0, 0},
+    {0, 2, 5, 6, 9, 0, 0, 0, 0, 0, 0, 0},
+    {0, 1, 2, 3, 5, 6, 8, 0, 0, 0, 0, 0},
+    {1, 2, 5, 6, 0, 0, 0, 0, 0, 0, 0, 0},
+    {1, 3, 5, 6, 8, 9, 10, 0, 0, 0, 0, 0},
+    {0, 1, 5, 6, 9, 10, 0, 0, 0, 0, 0, 0},
+    {0, 3, 5, 6, 8, 10, 0, 0, 0, 0, 0, 0},
+    {5, 6, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {5, 7, 10, 11, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 3, 5, 7, 8, 10, 11, 0, 0, 0, 0, 0},
+    {0, 1, 5, 7, 9, 10, 11, 0, 0, 0, 0, 0},
+    {1, 3, 5, 7, 8, 9, 10, 11, 0, 0, 0, 0},
+    {1, 2, 5, 7, 11, 0, 0, 0, 0, 0, 0, 0},
+    {0, 1, 2, 3, 5, 7, 8, 11, 0, 0, 0, 0},
+    {0, 2, 5, 7, 9, 11, 0, 0, 0, 0, 0, 0},
+    {2, 3, 5, 7, 8, 9, 11, 0, 0, 0, 0, 0},
+    {2, 3, 5, 7, 10, 0, 0, 0, 0, 0, 0, 0},
+    {0, 2, 5, 7, 8, 10, 0, 0, 0, 0, 0, 0},
+    {0, 1, 2, 3, 5, 7, 9, 10, 0, 0, 0, 0},
+    {1, 2, 5, 7, 8, 9, 10, 0, 0, 0, 0, 0},
+    {1, 3, 5, 7, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 1, 5, 7, 8, 0, 0, 0, 0, 0, 0, 0},
+    {0, 3, 5, 7, 9, 0, 0, 0, 0, 0, 0, 0},
+    {5, 7, 8, 9, 0, 0, 0, 0, 0, 0, 0, 0},
+    {4, 5, 8, 10, 11, 0, 0, 0, 0, 0, 0, 0},
+    {0, 3, 4, 5, 10, 11, 0, 0, 0, 0, 0, 0},
+    {0, 1, 4, 5, 8, 9, 10, 11, 0, 0, 0, 0},
+    {1, 3, 4, 5, 9, 10, 11, 0, 0, 0, 0, 0},
+    {1, 2, 4, 5, 8, 11, 0, 0, 0, 0, 0, 0},
+    {0, 1, 2, 3, 4, 5, 11, 0, 0, 0, 0, 0},
+    {0, 2, 4, 5, 8, 9, 11, 0, 0, 0, 0, 0},
+    {2, 3, 4, 5, 9, 11, 0, 0, 0, 0, 0, 0},
+    {2, 3, 4, 5, 8, 10, 0, 0, 0, 0, 0, 0},
+    {0, 2, 4, 5, 10, 0, 0, 0, 0, 0, 0, 0},
+    {0, 1, 2, 3, 4, 5, 8, 9, 10, 0, 0, 0},
+    {1, 2, 4, 5, 9, 10, 0, 0, 0, 0, 0, 0},
+    {1, 3, 4, 5, 8, 0, 0, 0, 0, 0, 0, 0},
+    {0, 1, 4, 5, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 3, 4, 5, 8, 9, 0, 0, 0, 0, 0, 0},
+    {4, 5, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {4, 7, 9, 10, 11, 0, 0, 0, 0, 0, 0, 0},
+    {0, 3, 4, 7, 8, 9, 10, 11, 0, 0, 0, 0},
+    {0, 1, 4, 7, 10, 11, 0, 0, 0, 0, 0, 0},
+    {1, 3, 4, 7, 8, 10, 11, 0, 0, 0, 0, 0},
+    {1, 2, 4, 7, 9, 11, 0, 0, 0, 0, 0, 0},
+    {0, 1, 2, 3, 4, 7, 8, 9, 11, 0, 0, 0},
+    {0, 2, 4, 7, 11, 0, 0, 0, 0, 0, 0, 0},
+    {2, 3, 4, 7, 8, 11, 0, 0, 0, 0, 0, 0},
+    {2, 3, 4, 7, 9, 10, 0, 0, 0, 0, 0, 0},
+    {0, 2, 4, 7, 8, 9, 10, 0, 0, 0, 0, 0},
+    {0, 1, 2, 3, 4, 7, 10, 0, 0, 0, 0, 0},
+    {1, 2, 4, 7, 8, 10, 0, 0, 0, 0, 0, 0},
+    {1, 3, 4, 7, 9, 0, 0, 0, 0, 0, 0, 0},
+    {0, 1, 4, 7, 8, 9, 0, 0, 0, 0, 0, 0},
+    {0, 3, 4, 7, 0, 0, 0, 0, 0, 0, 0, 0},
+    {4, 7, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {8, 9, 10, 11, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 3, 9, 10, 11, 0, 0, 0, 0, 0, 0, 0},
+    {0, 1, 8, 10, 11, 0, 0, 0, 0, 0, 0, 0},
+    {1, 3, 10, 11, 0, 0, 0, 0, 0, 0, 0, 0},
+    {1, 2, 8, 9, 11, 0, 0, 0, 0, 0, 0, 0},
+    {0, 1, 2, 3, 9, 11, 0, 0, 0, 0, 0, 0},
+    {0, 2, 8, 11, 0, 0, 0, 0, 0, 0, 0, 0},
+    {2, 3, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {2, 3, 8, 9, 10, 0, 0, 0, 0, 0, 0, 0},
+    {0, 2, 9, 10, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 1, 2, 3, 8, 10, 0, 0, 0, 0, 0, 0},
+    {1, 2, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {1, 3, 8, 9, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 1, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 3, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}};
+
+// Triangles of each case as indices into case_edges[case] instead of edge ids, so that triangle corners directly
+// address the vertices created for the case. The first 3 * triangle_count_table entries are valid.
+static constexpr uint8_t case_triangles[256][15] = {
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 2, 1, 3, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 4, 3, 1, 2, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {2, 1, 3, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 2, 1, 0, 4, 2, 4, 3, 2, 0, 0, 0, 0, 0, 0},
+    {1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 3, 1, 2, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {1, 4, 0, 2, 3, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 4, 1, 0, 3, 4, 3, 2, 4, 0, 0, 0, 0, 0, 0},
+    {1, 2, 0, 3, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 3, 1, 0, 2, 3, 2, 4, 3, 0, 0, 0, 0, 0, 0},
+    {1, 2, 0, 1, 4, 2, 4, 3, 2, 0, 0, 0, 0, 0, 0},
+    {1, 0, 2, 2, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {2, 1, 0, 3, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 1, 5, 4, 2, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {2, 0, 4, 2, 3, 0, 3, 1, 0, 0, 0, 0, 0, 0, 0},
+    {0, 1, 5, 4, 2, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {3, 4, 5, 3, 0, 4, 1, 2, 6, 0, 0, 0, 0, 0, 0},
+    {5, 1, 6, 5, 0, 1, 4, 2, 3, 0, 0, 0, 0, 0, 0},
+    {0, 5, 4, 0, 4, 3, 0, 3, 1, 3, 4, 2, 0, 0, 0},
+    {4, 2, 3, 1, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {4, 2, 3, 4, 1, 2, 1, 0, 2, 0, 0, 0, 0, 0, 0},
+    {7, 0, 1, 6, 4, 5, 2, 3, 8, 0, 0, 0, 0, 0, 0},
+    {2, 3, 5, 4, 2, 5, 4, 5, 1, 4, 1, 0, 0, 0, 0},
+    {1, 5, 0, 1, 6, 5, 3, 4, 2, 0, 0, 0, 0, 0, 0},
+    {1, 5, 4, 1, 2, 5, 1, 0, 2, 3, 5, 2, 0, 0, 0},
+    {2, 3, 4, 5, 0, 7, 5, 7, 6, 7, 0, 1, 0, 0, 0},
+    {0, 1, 4, 0, 4, 2, 2, 4, 3, 0, 0, 0, 0, 0, 0},
+    {2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {5, 3, 2, 0, 4, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 3, 2, 1, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {4, 3, 2, 4, 1, 3, 1, 0, 3, 0, 0, 0, 0, 0, 0},
+    {0, 1, 5, 4, 3, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {3, 0, 6, 1, 2, 8, 4, 7, 5, 0, 0, 0, 0, 0, 0},
+    {3, 1, 4, 3, 2, 1, 2, 0, 1, 0, 0, 0, 0, 0, 0},
+    {0, 5, 3, 1, 0, 3, 1, 3, 2, 1, 2, 4, 0, 0, 0},
+    {4, 3, 2, 0, 1, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 6, 1, 0, 4, 6, 2, 5, 3, 0, 0, 0, 0, 0, 0},
+    {0, 5, 4, 0, 1, 5, 2, 3, 6, 0, 0, 0, 0, 0, 0},
+    {1, 0, 3, 1, 3, 4, 1, 4, 5, 2, 4, 3, 0, 0, 0},
+    {5, 1, 6, 5, 0, 1, 4, 3, 2, 0, 0, 0, 0, 0, 0},
+    {2, 5, 3, 0, 4, 1, 4, 6, 1, 4, 7, 6, 0, 0, 0},
+    {3, 2, 0, 3, 0, 5, 3, 5, 4, 5, 0, 1, 0, 0, 0},
+    {1, 0, 2, 1, 2, 3, 3, 2, 4, 0, 0, 0, 0, 0, 0},
+    {3, 1, 2, 0, 1, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {4, 1, 0, 4, 2, 1, 2, 3, 1, 0, 0, 0, 0, 0, 0},
+    {0, 3, 4, 0, 1, 3, 1, 2, 3, 0, 0, 0, 0, 0, 0},
+    {0, 2, 1, 1, 2, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {5, 3, 4, 5, 2, 3, 6, 0, 1, 0, 0, 0, 0, 0, 0},
+    {7, 1, 2, 6, 4, 0, 4, 3, 0, 4, 5, 3, 0, 0, 0},
+    {4, 0, 1, 4, 1, 2, 4, 2, 3, 5, 2, 1, 0, 0, 0},
+    {0, 4, 2, 0, 2, 1, 1, 2, 3, 0, 0, 0, 0, 0, 0},
+    {3, 5, 2, 3, 4, 5, 1, 6, 0, 0, 0, 0, 0, 0, 0},
+    {4, 2, 3, 4, 3, 1, 4, 1, 0, 1, 3, 5, 0, 0, 0},
+    {2, 3, 7, 0, 1, 6, 1, 5, 6, 1, 4, 5, 0, 0, 0},
+    {4, 1, 0, 4, 0, 3, 3, 0, 2, 0, 0, 0, 0, 0, 0},
+    {5, 2, 4, 4, 2, 3, 6, 0, 1, 6, 1, 7, 0, 0, 0},
+    {2, 3, 0, 2, 0, 4, 3, 6, 0, 1, 0, 5, 6, 5, 0},
+    {6, 5, 0, 6, 0, 1, 5, 2, 0, 4, 0, 3, 2, 3, 0},
+    {3, 2, 0, 1, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 4, 1, 2, 5, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {4, 0, 1, 2, 5, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 4, 1, 0, 5, 4, 2, 6, 3, 0, 0, 0, 0, 0, 0},
+    {0, 3, 2, 1, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {1, 5, 4, 1, 2, 5, 3, 0, 6, 0, 0, 0, 0, 0, 0},
+    {4, 3, 2, 4, 0, 3, 0, 1, 3, 0, 0, 0, 0, 0, 0},
+    {2, 5, 4, 2, 4, 0, 2, 0, 3, 1, 0, 4, 0, 0, 0},
+    {0, 1, 5, 4, 3, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {6, 0, 4, 6, 1, 0, 5, 3, 2, 0, 0, 0, 0, 0, 0},
+    {0, 1, 6, 2, 3, 8, 4, 7, 5, 0, 0, 0, 0, 0, 0},
+    {2, 6, 3, 0, 5, 1, 5, 7, 1, 5, 4, 7, 0, 0, 0},
+    {3, 1, 4, 3, 2, 1, 2, 0, 1, 0, 0, 0, 0, 0, 0},
+    {0, 4, 5, 0, 5, 2, 0, 2, 1, 2, 5, 3, 0, 0, 0},
+    {1, 5, 3, 0, 1, 3, 0, 3, 2, 0, 2, 4, 0, 0, 0},
+    {1, 0, 3, 1, 3, 4, 4, 3, 2, 0, 0, 0, 0, 0, 0},
+    {1, 5, 2, 0, 3, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {2, 1, 0, 2, 5, 1, 4, 3, 6, 0, 0, 0, 0, 0, 0},
+    {1, 7, 0, 3, 8, 4, 6, 2, 5, 0, 0, 0, 0, 0, 0},
+    {7, 4, 3, 0, 6, 5, 0, 5, 1, 5, 6, 2, 0, 0, 0},
+    {4, 0, 1, 4, 3, 0, 2, 5, 6, 0, 0, 0, 0, 0, 0},
+    {1, 2, 5, 5, 2, 6, 3, 0, 4, 3, 4, 7, 0, 0, 0},
+    {6, 2, 5, 7, 0, 3, 0, 4, 3, 0, 1, 4, 0, 0, 0},
+    {5, 1, 6, 5, 6, 2, 1, 0, 6, 3, 6, 4, 0, 4, 6},
+    {1, 8, 0, 5, 6, 2, 7, 4, 3, 0, 0, 0, 0, 0, 0},
+    {3, 6, 4, 2, 5, 1, 2, 1, 0, 1, 5, 7, 0, 0, 0},
+    {0, 1, 9, 4, 7, 8, 2, 3, 11, 5, 10, 6, 0, 0, 0},
+    {6, 1, 0, 6, 8, 1, 6, 2, 8, 5, 8, 2, 3, 7, 4},
+    {6, 2, 5, 1, 7, 3, 1, 3, 0, 3, 7, 4, 0, 0, 0},
+    {3, 1, 6, 3, 6, 4, 1, 0, 6, 5, 6, 2, 0, 2, 6},
+    {0, 3, 7, 0, 4, 3, 0, 1, 4, 8, 4, 1, 6, 2, 5},
+    {2, 1, 4, 2, 4, 5, 0, 3, 4, 3, 5, 4, 0, 0, 0},
+    {3, 0, 2, 1, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {2, 6, 3, 2, 5, 6, 0, 4, 1, 0, 0, 0, 0, 0, 0},
+    {4, 0, 1, 4, 3, 0, 3, 2, 0, 0, 0, 0, 0, 0, 0},
+    {4, 1, 0, 4, 0, 3, 4, 3, 2, 3, 0, 5, 0, 0, 0},
+    {0, 2, 4, 0, 1, 2, 1, 3, 2, 0, 0, 0, 0, 0, 0},
+    {3, 0, 6, 1, 2, 7, 2, 4, 7, 2, 5, 4, 0, 0, 0},
+    {0, 1, 2, 2, 1, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {4, 1, 0, 4, 0, 2, 2, 0, 3, 0, 0, 0, 0, 0, 0},
+    {5, 2, 4, 5, 3, 2, 6, 0, 1, 0, 0, 0, 0, 0, 0},
+    {0, 4, 1, 1, 4, 7, 2, 5, 6, 2, 6, 3, 0, 0, 0},
+    {3, 7, 2, 0, 1, 5, 0, 5, 4, 5, 1, 6, 0, 0, 0},
+    {3, 2, 0, 3, 0, 5, 2, 4, 0, 1, 0, 6, 4, 6, 0},
+    {4, 3, 2, 4, 1, 3, 4, 0, 1, 5, 3, 1, 0, 0, 0},
+    {4, 6, 1, 4, 1, 0, 6, 3, 1, 5, 1, 2, 3, 2, 1},
+    {1, 4, 3, 1, 3, 0, 0, 3, 2, 0, 0, 0, 0, 0, 0},
+    {1, 0, 2, 3, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {1, 4, 0, 1, 2, 4, 2, 3, 4, 0, 0, 0, 0, 0, 0},
+    {0, 3, 1, 0, 5, 3, 0, 4, 5, 2, 3, 5, 0, 0, 0},
+    {5, 2, 3, 1, 5, 3, 1, 3, 4, 1, 4, 0, 0, 0, 0},
+    {4, 2, 3, 4, 3, 0, 0, 3, 1, 0, 0, 0, 0, 0, 0},
+    {0, 1, 2, 0, 2, 4, 0, 4, 5, 4, 2, 3, 0, 0, 0},
+    {2, 4, 6, 2, 6, 1, 4, 5, 6, 0, 6, 3, 5, 3, 6},
+    {3, 4, 0, 3, 0, 2, 2, 0, 1, 0, 0, 0, 0, 0, 0},
+    {3, 1, 0, 2, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 1, 7, 6, 2, 4, 6, 4, 5, 4, 2, 3, 0, 0, 0},
+    {1, 0, 3, 1, 3, 6, 0, 4, 3, 2, 3, 5, 4, 5, 3},
+    {1, 6, 0, 1, 5, 6, 1, 7, 5, 4, 5, 7, 2, 3, 8},
+    {5, 1, 0, 5, 0, 3, 4, 2, 0, 2, 3, 0, 0, 0, 0},
+    {4, 5, 2, 4, 2, 3, 5, 0, 2, 6, 2, 1, 0, 1, 2},
+    {0, 4, 1, 5, 2, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {3, 4, 0, 3, 0, 2, 1, 5, 0, 5, 2, 0, 0, 0, 0},
+    {1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {1, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {1, 0, 4, 5, 3, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 1, 4, 5, 3, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {4, 0, 5, 4, 1, 0, 6, 3, 2, 0, 0, 0, 0, 0, 0},
+    {4, 0, 1, 2, 5, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {1, 2, 7, 3, 0, 6, 4, 8, 5, 0, 0, 0, 0, 0, 0},
+    {1, 4, 0, 1, 5, 4, 2, 6, 3, 0, 0, 0, 0, 0, 0},
+    {2, 7, 3, 0, 6, 1, 6, 4, 1, 6, 5, 4, 0, 0, 0},
+    {3, 0, 1, 2, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {3, 0, 4, 3, 2, 0, 2, 1, 0, 0, 0, 0, 0, 0, 0},
+    {2, 5, 4, 2, 3, 5, 0, 1, 6, 0, 0, 0, 0, 0, 0},
+    {0, 2, 1, 0, 4, 2, 0, 5, 4, 4, 3, 2, 0, 0, 0},
+    {4, 3, 2, 4, 0, 3, 0, 1, 3, 0, 0, 0, 0, 0, 0},
+    {5, 3, 2, 1, 3, 5, 1, 4, 3, 1, 0, 4, 0, 0, 0},
+    {0, 1, 3, 0, 3, 5, 0, 5, 4, 2, 5, 3, 0, 0, 0},
+    {1, 0, 4, 1, 4, 2, 2, 4, 3, 0, 0, 0, 0, 0, 0},
+    {1, 2, 0, 3, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {1, 3, 4, 1, 0, 3, 0, 2, 3, 0, 0, 0, 0, 0, 0},
+    {4, 3, 6, 4, 2, 3, 5, 0, 1, 0, 0, 0, 0, 0, 0},
+    {4, 2, 3, 4, 3, 1, 4, 1, 0, 5, 1, 3, 0, 0, 0},
+    {3, 4, 2, 3, 6, 4, 1, 5, 0, 0, 0, 0, 0, 0, 0},
+    {1, 2, 6, 3, 0, 7, 0, 5, 7, 0, 4, 5, 0, 0, 0},
+    {2, 7, 4, 2, 3, 7, 0, 1, 5, 1, 6, 5, 0, 0, 0},
+    {5, 4, 1, 5, 1, 0, 4, 2, 1, 6, 1, 3, 2, 3, 1},
+    {4, 0, 1, 4, 2, 0, 2, 3, 0, 0, 0, 0, 0, 0, 0},
+    {0, 2, 1, 2, 3, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {1, 7, 0, 2, 3, 4, 2, 4, 5, 4, 3, 6, 0, 0, 0},
+    {0, 4, 2, 0, 2, 1, 1, 2, 3, 0, 0, 0, 0, 0, 0},
+    {4, 0, 1, 4, 3, 0, 4, 2, 3, 3, 5, 0, 0, 0, 0},
+    {4, 1, 0, 4, 0, 3, 3, 0, 2, 0, 0, 0, 0, 0, 0},
+    {2, 3, 1, 2, 1, 4, 3, 6, 1, 0, 1, 5, 6, 5, 1},
+    {3, 2, 0, 1, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 4, 1, 3, 2, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 6, 1, 2, 7, 3, 8, 5, 4, 0, 0, 0, 0, 0, 0},
+    {3, 0, 1, 3, 2, 0, 5, 4, 6, 0, 0, 0, 0, 0, 0},
+    {7, 5, 4, 6, 1, 2, 1, 3, 2, 1, 0, 3, 0, 0, 0},
+    {6, 3, 2, 7, 0, 1, 5, 4, 8, 0, 0, 0, 0, 0, 0},
+    {6, 11, 7, 1, 2, 10, 0, 8, 3, 4, 9, 5, 0, 0, 0},
+    {5, 4, 7, 3, 2, 6, 2, 1, 6, 2, 0, 1, 0, 0, 0},
+    {1, 2, 6, 1, 3, 2, 1, 0, 3, 7, 3, 0, 8, 5, 4},
+    {5, 0, 1, 5, 4, 0, 3, 2, 6, 0, 0, 0, 0, 0, 0},
+    {7, 3, 2, 0, 6, 4, 0, 4, 1, 4, 6, 5, 0, 0, 0},
+    {3, 6, 2, 3, 7, 6, 1, 5, 0, 5, 4, 0, 0, 0, 0},
+    {4, 1, 6, 4, 6, 5, 1, 0, 6, 2, 6, 3, 0, 3, 6},
+    {6, 3, 2, 7, 0, 4, 0, 5, 4, 0, 1, 5, 0, 0, 0},
+    {1, 4, 8, 1, 5, 4, 1, 0, 5, 6, 5, 0, 7, 3, 2},
+    {2, 0, 6, 2, 6, 3, 0, 1, 6, 4, 6, 5, 1, 5, 6},
+    {3, 2, 5, 3, 5, 4, 1, 0, 5, 0, 4, 5, 0, 0, 0},
+    {1, 3, 0, 1, 4, 3, 4, 2, 3, 0, 0, 0, 0, 0, 0},
+    {1, 3, 5, 0, 3, 1, 0, 2, 3, 0, 4, 2, 0, 0, 0},
+    {0, 5, 4, 0, 2, 5, 0, 1, 2, 2, 3, 5, 0, 0, 0},
+    {3, 4, 1, 3, 1, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0},
+    {0, 1, 6, 5, 2, 7, 5, 7, 4, 7, 2, 3, 0, 0, 0},
+    {0, 8, 3, 0, 5, 8, 0, 6, 5, 4, 5, 6, 1, 2, 7},
+    {6, 4, 2, 6, 2, 3, 4, 0, 2, 5, 2, 1, 0, 1, 2},
+    {3, 5, 1, 3, 1, 2, 0, 4, 1, 4, 2, 1, 0, 0, 0},
+    {2, 4, 5, 2, 0, 4, 2, 3, 0, 1, 4, 0, 0, 0, 0},
+    {4, 2, 3, 4, 3, 0, 0, 3, 1, 0, 0, 0, 0, 0, 0},
+    {1, 4, 6, 1, 6, 0, 4, 5, 6, 3, 6, 2, 5, 2, 6},
+    {0, 2, 3, 1, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 1, 3, 0, 3, 6, 1, 4, 3, 2, 3, 5, 4, 5, 3},
+    {5, 1, 0, 5, 0, 3, 4, 2, 0, 2, 3, 0, 0, 0, 0},
+    {0, 1, 4, 2, 3, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {2, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {3, 0, 2, 1, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {6, 2, 5, 6, 3, 2, 4, 1, 0, 0, 0, 0, 0, 0, 0},
+    {2, 6, 3, 2, 5, 6, 1, 4, 0, 0, 0, 0, 0, 0, 0},
+    {6, 3, 2, 6, 7, 3, 5, 4, 0, 4, 1, 0, 0, 0, 0},
+    {4, 0, 1, 4, 3, 0, 3, 2, 0, 0, 0, 0, 0, 0, 0},
+    {0, 6, 3, 1, 2, 5, 1, 5, 4, 5, 2, 7, 0, 0, 0},
+    {4, 3, 2, 4, 1, 3, 4, 0, 1, 1, 5, 3, 0, 0, 0},
+    {3, 2, 0, 3, 0, 6, 2, 5, 0, 1, 0, 4, 5, 4, 0},
+    {0, 2, 4, 0, 1, 2, 1, 3, 2, 0, 0, 0, 0, 0, 0},
+    {4, 1, 0, 4, 2, 1, 4, 3, 2, 5, 1, 2, 0, 0, 0},
+    {6, 0, 1, 4, 7, 3, 4, 3, 5, 3, 7, 2, 0, 0, 0},
+    {5, 4, 1, 5, 1, 0, 4, 3, 1, 6, 1, 2, 3, 2, 1},
+    {0, 1, 2, 1, 3, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 4, 3, 0, 3, 1, 1, 3, 2, 0, 0, 0, 0, 0, 0},
+    {4, 0, 1, 4, 1, 2, 2, 1, 3, 0, 0, 0, 0, 0, 0},
+    {3, 2, 1, 0, 3, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {1, 2, 0, 1, 3, 2, 3, 4, 2, 0, 0, 0, 0, 0, 0},
+    {3, 0, 2, 3, 5, 0, 3, 4, 5, 5, 1, 0, 0, 0, 0},
+    {0, 1, 5, 4, 2, 6, 4, 6, 7, 6, 2, 3, 0, 0, 0},
+    {5, 6, 2, 5, 2, 3, 6, 1, 2, 4, 2, 0, 1, 0, 2},
+    {1, 3, 0, 1, 4, 3, 1, 5, 4, 2, 3, 4, 0, 0, 0},
+    {0, 4, 6, 0, 6, 3, 4, 5, 6, 2, 6, 1, 5, 1, 6},
+    {0, 1, 3, 0, 3, 5, 1, 6, 3, 2, 3, 4, 6, 4, 3},
+    {4, 2, 3, 0, 5, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 3, 5, 1, 3, 0, 1, 2, 3, 1, 4, 2, 0, 0, 0},
+    {3, 4, 1, 3, 1, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0},
+    {3, 8, 2, 3, 5, 8, 3, 6, 5, 4, 5, 6, 0, 1, 7},
+    {3, 5, 1, 3, 1, 2, 0, 4, 1, 4, 2, 1, 0, 0, 0},
+    {4, 2, 3, 4, 3, 1, 1, 3, 0, 0, 0, 0, 0, 0, 0},
+    {0, 2, 3, 1, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {4, 2, 3, 4, 3, 1, 5, 0, 3, 0, 1, 3, 0, 0, 0},
+    {2, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 4, 1, 0, 2, 4, 2, 3, 4, 0, 0, 0, 0, 0, 0},
+    {0, 4, 1, 2, 5, 3, 5, 7, 3, 5, 6, 7, 0, 0, 0},
+    {1, 4, 5, 1, 5, 2, 1, 2, 0, 3, 2, 5, 0, 0, 0},
+    {1, 0, 2, 1, 2, 4, 0, 5, 2, 3, 2, 6, 5, 6, 2},
+    {2, 5, 3, 4, 5, 2, 4, 1, 5, 4, 0, 1, 0, 0, 0},
+    {7, 5, 4, 7, 8, 5, 7, 1, 8, 2, 8, 1, 0, 6, 3},
+    {4, 3, 2, 4, 2, 1, 1, 2, 0, 0, 0, 0, 0, 0, 0},
+    {5, 3, 2, 5, 2, 0, 4, 1, 2, 1, 0, 2, 0, 0, 0},
+    {0, 4, 5, 0, 3, 4, 0, 1, 3, 3, 2, 4, 0, 0, 0},
+    {5, 6, 3, 5, 3, 2, 6, 1, 3, 4, 3, 0, 1, 0, 3},
+    {3, 5, 6, 3, 6, 2, 5, 4, 6, 1, 6, 0, 4, 0, 6},
+    {0, 5, 1, 4, 3, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {2, 4, 0, 2, 0, 3, 3, 0, 1, 0, 0, 0, 0, 0, 0},
+    {2, 5, 1, 2, 1, 3, 0, 4, 1, 4, 3, 1, 0, 0, 0},
+    {2, 0, 1, 3, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {1, 2, 0, 2, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {1, 0, 2, 1, 2, 4, 4, 2, 3, 0, 0, 0, 0, 0, 0},
+    {0, 1, 3, 0, 3, 2, 2, 3, 4, 0, 0, 0, 0, 0, 0},
+    {1, 0, 2, 3, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 1, 4, 0, 4, 3, 3, 4, 2, 0, 0, 0, 0, 0, 0},
+    {3, 0, 4, 3, 4, 5, 1, 2, 4, 2, 5, 4, 0, 0, 0},
+    {0, 1, 3, 2, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {1, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 1, 2, 0, 2, 4, 4, 2, 3, 0, 0, 0, 0, 0, 0},
+    {2, 3, 1, 0, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {2, 3, 4, 2, 4, 5, 0, 1, 4, 1, 5, 4, 0, 0, 0},
+    {0, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 1, 2, 3, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}};
 }  // namespace SCALAR_POLYGONIZATION
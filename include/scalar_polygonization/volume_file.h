@@ -0,0 +1,139 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright 2019 Lakshman Anumolu.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "scalar_polygonization/polygonize_function.h"
+#include "scalar_polygonization/polygonize_volume.h"
+#include "scalar_polygonization/vec3.h"
+
+#include <stddef.h>
+#include <string>
+
+namespace SCALAR_POLYGONIZATION
+{
+/*! Type of the values stored in a volume file.
+ */
+enum class ScalarType { UINT8, UINT16, FLOAT, DOUBLE };
+
+/*!
+ * \class VolumeFile
+ *
+ * Volume stored in a raw binary file or in an NRRD file, memory mapped read only.
+ *
+ * Values are not read into memory: `volume()` returns a `ScalarVolume` viewing the mapping, whose pages are loaded
+ * by the operating system as the extractor touches them, and the mapping is advised for sequential access since
+ * slabs march along z. Values must be stored x fastest, in the byte order of the host.
+ *
+ * A value section whose offset in the file is not a multiple of the value size (e.g. after an NRRD header of
+ * arbitrary length) cannot be viewed as an array of its type: `volume()` throws for it, and `planeSampler()` reads
+ * it from the mapping one node plane at a time instead, for `polygonizePlanes`. Values are never copied as a whole.
+ *
+ * Errors (missing file, unsupported or inconsistent header, file too small) throw `std::runtime_error`.
+ */
+class VolumeFile
+{
+ public:
+  /*! Open a raw file.
+   *
+   * \param path path of the file.
+   * \param type type of the values.
+   * \param dims number of nodes along x, y, z.
+   * \param offset number of bytes before the first value, e.g. a header.
+   */
+  VolumeFile(const std::string& path, const ScalarType type, const Vec3<int>& dims, const size_t offset = 0);
+
+  /*! Open an NRRD file, with attached data or a detached raw `data file`.
+   *
+   * Three dimensional volumes of `uchar`, `ushort`, `float` or `double` with `raw` encoding are supported. Node
+   * spacing comes from `spacings` or axis aligned `space directions`, position of node (0, 0, 0) from `space origin`.
+   * Attached data follows the empty line ending the header, a detached header may end with the file.
+   *
+   * \param path path of the `.nrrd` (or detached `.nhdr`) file.
+   */
+  explicit VolumeFile(const std::string& path);
+
+  ~VolumeFile();
+
+  VolumeFile(const VolumeFile&) = delete;
+  VolumeFile& operator=(const VolumeFile&) = delete;
+
+  /*! Returns type of the values.
+   */
+  ScalarType type() const { return m_type; }
+
+  /*! Returns number of nodes along x, y, z.
+   */
+  const Vec3<int> dims() const { return Vec3<int>(m_dims[0], m_dims[1], m_dims[2]); }
+
+  /*! Returns position of node (0, 0, 0), zero unless given by the file.
+   */
+  const Vec3<double> origin() const { return Vec3<double>(m_origin[0], m_origin[1], m_origin[2]); }
+
+  /*! Returns distance between two consecutive nodes along x, y, z, one unless given by the file.
+   */
+  const Vec3<double> spacing() const { return Vec3<double>(m_spacing[0], m_spacing[1], m_spacing[2]); }
+
+  /*! Returns whether values are aligned to their size in the mapping, i.e. whether `volume()` can view them.
+   */
+  bool aligned() const { return m_aligned; }
+
+  /*! View of the values, valid as long as this object.
+   *
+   * Throws `std::runtime_error` if S is not the type of the file or values are not `aligned()`.
+   *
+   * \return volume of values of type S, with positions of type T.
+   */
+  template <typename T, typename S>
+  ScalarVolume<T, S> volume() const;
+
+  /*! Sampler reading node planes from the mapping, for values at any offset, valid as long as this object.
+   *
+   * Values are read one at a time with unaligned loads and converted to T. Planes may be read concurrently.
+   *
+   * \return sampler filling node plane k with the values of the file.
+   */
+  template <typename T>
+  PlaneSampler<T> planeSampler() const;
+
+ private:
+  void open(const std::string& path, const size_t offset, const bool offset_from_end);
+
+  ScalarType m_type;
+  int m_dims[3];
+  double m_origin[3];
+  double m_spacing[3];
+  void* m_mapping;             //!< Start of the mapping of the file, nullptr if not mapped.
+  size_t m_mapping_size;       //!< Size of the mapping in bytes.
+  const char* m_values;        //!< First value in the mapping.
+  bool m_aligned;              //!< Whether `m_values` is aligned to the value size.
+};
+}  // namespace SCALAR_POLYGONIZATION
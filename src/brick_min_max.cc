@@ -0,0 +1,102 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright 2019 Lakshman Anumolu.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///////////////////////////////////////////////////////////////////////////////
+
+#include "scalar_polygonization/brick_min_max.h"
+#include "scalar_polygonization/parallel.h"
+
+#include <algorithm>
+
+template <typename T>
+constexpr int SCALAR_POLYGONIZATION::BrickMinMax<T>::BRICK_SIZE;
+
+template <typename T>
+SCALAR_POLYGONIZATION::BrickMinMax<T>::BrickMinMax(const ScalarVolume<T>& volume, const unsigned num_threads)
+{
+  for (int axis = 0; axis < 3; ++axis) {
+    m_dims[axis] = volume.dim(axis);
+    m_num_bricks[axis] = std::max(0, (volume.dim(axis) - 1 + BRICK_SIZE - 1) / BRICK_SIZE);
+  }
+
+  const size_t num_bricks = static_cast<size_t>(m_num_bricks[0]) * m_num_bricks[1] * m_num_bricks[2];
+  m_min.resize(num_bricks);
+  m_max.resize(num_bricks);
+
+  parallelFor(m_num_bricks[2], num_threads, [&](const size_t bk) {
+    for (int bj = 0; bj < m_num_bricks[1]; ++bj)
+      for (int bi = 0; bi < m_num_bricks[0]; ++bi) this->computeBrick(volume, bi, bj, static_cast<int>(bk));
+  });
+}
+
+template <typename T>
+void SCALAR_POLYGONIZATION::BrickMinMax<T>::update(const ScalarVolume<T>& volume, const Vec3<int>& node_begin,
+                                                   const Vec3<int>& node_end)
+{
+  // Node n lies in bricks (n - 1) / BRICK_SIZE and n / BRICK_SIZE.
+  int brick_begin[3], brick_end[3];
+  for (int axis = 0; axis < 3; ++axis) {
+    const int begin = std::max(node_begin[axis], 0), end = std::min(node_end[axis], m_dims[axis]);
+    if (begin >= end) return;
+
+    brick_begin[axis] = std::max(begin - 1, 0) / BRICK_SIZE;
+    brick_end[axis] = std::min((end - 1) / BRICK_SIZE + 1, m_num_bricks[axis]);
+  }
+
+  for (int bk = brick_begin[2]; bk < brick_end[2]; ++bk)
+    for (int bj = brick_begin[1]; bj < brick_end[1]; ++bj)
+      for (int bi = brick_begin[0]; bi < brick_end[0]; ++bi) this->computeBrick(volume, bi, bj, bk);
+}
+
+template <typename T>
+void SCALAR_POLYGONIZATION::BrickMinMax<T>::computeBrick(const ScalarVolume<T>& volume, const int bi, const int bj,
+                                                         const int bk)
+{
+  const int i_begin = bi * BRICK_SIZE, i_end = std::min(i_begin + BRICK_SIZE + 1, m_dims[0]);
+  const int j_begin = bj * BRICK_SIZE, j_end = std::min(j_begin + BRICK_SIZE + 1, m_dims[1]);
+  const int k_begin = bk * BRICK_SIZE, k_end = std::min(k_begin + BRICK_SIZE + 1, m_dims[2]);
+
+  T min = volume(i_begin, j_begin, k_begin), max = min;
+  for (int k = k_begin; k < k_end; ++k)
+    for (int j = j_begin; j < j_end; ++j) {
+      const T* row = volume.data() + volume.offset(0, j, k);
+      for (int i = i_begin; i < i_end; ++i) {
+        const T value = row[i * volume.stride(0)];
+        min = std::min(min, value);
+        max = std::max(max, value);
+      }
+    }
+
+  const size_t b = this->index(bi, bj, bk);
+  m_min[b] = min;
+  m_max[b] = max;
+}
+
+template class SCALAR_POLYGONIZATION::BrickMinMax<float>;
+template class SCALAR_POLYGONIZATION::BrickMinMax<double>;
@@ -0,0 +1,310 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright 2019 Lakshman Anumolu.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///////////////////////////////////////////////////////////////////////////////
+
+#include "scalar_polygonization/classification.h"
+#include "scalar_polygonization/tables.h"
+
+#include <cmath>
+#include <limits>
+#include <string.h>
+
+#if defined(__AVX__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+namespace
+{
+template <typename T>
+void classifyScalar(const T* row, const size_t stride, const int begin, const int end, const T iso_alpha,
+                    uint64_t* bits)
+{
+  for (int i = begin; i < end; ++i) bits[i >> 6] |= static_cast<uint64_t>(row[i * stride] < iso_alpha) << (i & 63);
+}
+
+template <typename T>
+void classifyContiguous(const T* row, const int begin, const int end, const T iso_alpha, uint64_t* bits)
+{
+  classifyScalar(row, 1, begin, end, iso_alpha, bits);
+}
+
+void classifyContiguous(const float* row, const int begin, const int end, const float iso_alpha, uint64_t* bits)
+{
+  int i = begin;
+  for (; i < end && (i & 7); ++i) bits[i >> 6] |= static_cast<uint64_t>(row[i] < iso_alpha) << (i & 63);
+
+  // Groups of 8 (or 4) nodes starting at a multiple of 8 never straddle two words.
+#if defined(__AVX__)
+  const __m256 iso = _mm256_set1_ps(iso_alpha);
+  for (; i + 8 <= end; i += 8) {
+    const int mask = _mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(row + i), iso, _CMP_LT_OQ));
+    bits[i >> 6] |= static_cast<uint64_t>(mask) << (i & 63);
+  }
+#elif defined(__SSE2__)
+  const __m128 iso = _mm_set1_ps(iso_alpha);
+  for (; i + 4 <= end; i += 4) {
+    const int mask = _mm_movemask_ps(_mm_cmplt_ps(_mm_loadu_ps(row + i), iso));
+    bits[i >> 6] |= static_cast<uint64_t>(mask) << (i & 63);
+  }
+#endif
+
+  for (; i < end; ++i) bits[i >> 6] |= static_cast<uint64_t>(row[i] < iso_alpha) << (i & 63);
+}
+
+void classifyContiguous(const double* row, const int begin, const int end, const double iso_alpha, uint64_t* bits)
+{
+  int i = begin;
+  for (; i < end && (i & 7); ++i) bits[i >> 6] |= static_cast<uint64_t>(row[i] < iso_alpha) << (i & 63);
+
+#if defined(__AVX__)
+  const __m256d iso = _mm256_set1_pd(iso_alpha);
+  for (; i + 4 <= end; i += 4) {
+    const int mask = _mm256_movemask_pd(_mm256_cmp_pd(_mm256_loadu_pd(row + i), iso, _CMP_LT_OQ));
+    bits[i >> 6] |= static_cast<uint64_t>(mask) << (i & 63);
+  }
+#elif defined(__SSE2__)
+  const __m128d iso = _mm_set1_pd(iso_alpha);
+  for (; i + 2 <= end; i += 2) {
+    const int mask = _mm_movemask_pd(_mm_cmplt_pd(_mm_loadu_pd(row + i), iso));
+    bits[i >> 6] |= static_cast<uint64_t>(mask) << (i & 63);
+  }
+#endif
+
+  for (; i < end; ++i) bits[i >> 6] |= static_cast<uint64_t>(row[i] < iso_alpha) << (i & 63);
+}
+
+void classifyContiguous(const uint8_t* row, const int begin, const int end, const uint8_t iso_alpha, uint64_t* bits)
+{
+  int i = begin;
+  for (; i < end && (i & 15); ++i) bits[i >> 6] |= static_cast<uint64_t>(row[i] < iso_alpha) << (i & 63);
+
+#if defined(__SSE2__)
+  // SSE2 compares signed integers only, flipping the sign bit maps the unsigned order onto the signed one.
+  const __m128i sign = _mm_set1_epi8(static_cast<char>(0x80));
+  const __m128i iso = _mm_xor_si128(_mm_set1_epi8(static_cast<char>(iso_alpha)), sign);
+  for (; i + 16 <= end; i += 16) {
+    const __m128i values = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(row + i)), sign);
+    const int mask = _mm_movemask_epi8(_mm_cmplt_epi8(values, iso));
+    bits[i >> 6] |= static_cast<uint64_t>(mask) << (i & 63);
+  }
+#endif
+
+  for (; i < end; ++i) bits[i >> 6] |= static_cast<uint64_t>(row[i] < iso_alpha) << (i & 63);
+}
+
+void classifyContiguous(const uint16_t* row, const int begin, const int end, const uint16_t iso_alpha,
+                        uint64_t* bits)
+{
+  int i = begin;
+  for (; i < end && (i & 15); ++i) bits[i >> 6] |= static_cast<uint64_t>(row[i] < iso_alpha) << (i & 63);
+
+#if defined(__SSE2__)
+  const __m128i sign = _mm_set1_epi16(static_cast<short>(0x8000));
+  const __m128i iso = _mm_xor_si128(_mm_set1_epi16(static_cast<short>(iso_alpha)), sign);
+  for (; i + 16 <= end; i += 16) {
+    const __m128i lo = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(row + i)), sign);
+    const __m128i hi = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(row + i + 8)), sign);
+    // Comparison results are 0 or -1, packing them to bytes keeps them and puts 16 nodes in one movemask.
+    const int mask = _mm_movemask_epi8(_mm_packs_epi16(_mm_cmplt_epi16(lo, iso), _mm_cmplt_epi16(hi, iso)));
+    bits[i >> 6] |= static_cast<uint64_t>(mask) << (i & 63);
+  }
+#endif
+
+  for (; i < end; ++i) bits[i >> 6] |= static_cast<uint64_t>(row[i] < iso_alpha) << (i & 63);
+}
+
+template <typename T>
+bool storageThreshold(const T iso_alpha, T& threshold)
+{
+  threshold = iso_alpha;
+  return true;
+}
+
+//! Integer values are below `iso_alpha` if and only if they are below `iso_alpha` rounded up.
+template <typename S, typename T>
+bool integerThreshold(const T iso_alpha, S& threshold)
+{
+  if (!(iso_alpha > std::numeric_limits<S>::min())) {
+    threshold = std::numeric_limits<S>::min();
+    return true;
+  }
+  if (iso_alpha > std::numeric_limits<S>::max()) return false;
+
+  threshold = static_cast<S>(std::ceil(iso_alpha));
+  return true;
+}
+
+template <typename T>
+bool storageThreshold(const T iso_alpha, uint8_t& threshold)
+{
+  return integerThreshold(iso_alpha, threshold);
+}
+
+template <typename T>
+bool storageThreshold(const T iso_alpha, uint16_t& threshold)
+{
+  return integerThreshold(iso_alpha, threshold);
+}
+
+#if defined(SP_HAS_FLOAT16)
+template <typename T>
+bool storageThreshold(const T iso_alpha, _Float16& threshold)
+{
+  threshold = static_cast<_Float16>(iso_alpha);
+  if (!(static_cast<T>(threshold) < iso_alpha)) return true;
+
+  // Rounded to the half below `iso_alpha`, step to the next one up (past -0 to the smallest positive half).
+  uint16_t half;
+  memcpy(&half, &threshold, sizeof(half));
+  half = half & 0x8000 ? (half == 0x8000 ? 1 : half - 1) : half + 1;
+  memcpy(&threshold, &half, sizeof(half));
+  return true;
+}
+#endif
+}  // namespace
+
+template <typename T>
+void SCALAR_POLYGONIZATION::classifyNodes(const T* row, const size_t stride, const int num_nodes, const T iso_alpha,
+                                          uint64_t* bits)
+{
+  memset(bits, 0, classificationWords(num_nodes) * sizeof(uint64_t));
+  classifyNodeRange(row, stride, 0, num_nodes, iso_alpha, bits);
+}
+
+template <typename T>
+void SCALAR_POLYGONIZATION::classifyNodeRange(const T* row, const size_t stride, const int begin, const int end,
+                                              const T iso_alpha, uint64_t* bits)
+{
+  if (stride == 1)
+    classifyContiguous(row, begin, end, iso_alpha, bits);
+  else
+    classifyScalar(row, stride, begin, end, iso_alpha, bits);
+}
+
+template <typename S, typename T>
+bool SCALAR_POLYGONIZATION::classificationThreshold(const T iso_alpha, S& threshold)
+{
+  return storageThreshold(iso_alpha, threshold);
+}
+
+int SCALAR_POLYGONIZATION::activeCubes(const uint64_t* row_00, const uint64_t* row_10, const uint64_t* row_01,
+                                       const uint64_t* row_11, const int num_cubes, int* cubes, uint8_t* cases)
+{
+  const uint64_t* rows[4] = {row_00, row_10, row_01, row_11};
+
+  // Cube vertex `v` is node `i + vertex_di[v]` of row `vertex_row[v]`.
+  int vertex_row[8], vertex_di[8];
+  for (int v = 0; v < 8; ++v) {
+    vertex_row[v] = static_cast<int>(vertex_offset[v][1]) + 2 * static_cast<int>(vertex_offset[v][2]);
+    vertex_di[v] = static_cast<int>(vertex_offset[v][0]);
+  }
+
+  int num_active = 0;
+
+  for (int w = 0; 64 * w < num_cubes; ++w) {
+    // Bit `b` of `node[di][row]` tells whether node `64 * w + b + di` is inside.
+    uint64_t node[2][4];
+    for (int r = 0; r < 4; ++r) {
+      node[0][r] = rows[r][w];
+      node[1][r] = (rows[r][w] >> 1) | (rows[r][w + 1] << 63);
+    }
+
+    // Bit `b` of `vertex[v]` is bit `v` of the case of cube `64 * w + b`.
+    uint64_t vertex[8], any_inside = 0, all_inside = ~static_cast<uint64_t>(0);
+    for (int v = 0; v < 8; ++v) {
+      vertex[v] = node[vertex_di[v]][vertex_row[v]];
+      any_inside |= vertex[v];
+      all_inside &= vertex[v];
+    }
+
+    uint64_t active = any_inside & ~all_inside;
+    if (num_cubes - 64 * w < 64) active &= (static_cast<uint64_t>(1) << (num_cubes - 64 * w)) - 1;
+
+    while (active) {
+      const int b = __builtin_ctzll(active);
+      active &= active - 1;
+
+      int vertex_flag = 0;
+      for (int v = 0; v < 8; ++v) vertex_flag |= static_cast<int>((vertex[v] >> b) & 1) << v;
+
+      cubes[num_active] = 64 * w + b;
+      cases[num_active] = static_cast<uint8_t>(vertex_flag);
+      ++num_active;
+    }
+  }
+
+  return num_active;
+}
+
+int SCALAR_POLYGONIZATION::crossedEdgesAlongRow(const uint64_t* row, const int num_nodes)
+{
+  int count = 0;
+  for (int w = 0; 64 * w < num_nodes; ++w)
+    count += __builtin_popcountll(row[w] ^ ((row[w] >> 1) | (row[w + 1] << 63)));
+
+  // Bits past the last node are cleared, the last node must not be paired with them.
+  return count - static_cast<int>((row[(num_nodes - 1) >> 6] >> ((num_nodes - 1) & 63)) & 1);
+}
+
+int SCALAR_POLYGONIZATION::crossedEdgesBetweenRows(const uint64_t* row_0, const uint64_t* row_1, const int num_nodes)
+{
+  int count = 0;
+  for (int w = 0; 64 * w < num_nodes; ++w) count += __builtin_popcountll(row_0[w] ^ row_1[w]);
+
+  return count;
+}
+
+template void SCALAR_POLYGONIZATION::classifyNodes<float>(const float*, const size_t, const int, const float,
+                                                          uint64_t*);
+template void SCALAR_POLYGONIZATION::classifyNodes<double>(const double*, const size_t, const int, const double,
+                                                           uint64_t*);
+template void SCALAR_POLYGONIZATION::classifyNodeRange<float>(const float*, const size_t, const int, const int,
+                                                              const float, uint64_t*);
+template void SCALAR_POLYGONIZATION::classifyNodeRange<double>(const double*, const size_t, const int, const int,
+                                                               const double, uint64_t*);
+template void SCALAR_POLYGONIZATION::classifyNodes<uint8_t>(const uint8_t*, const size_t, const int, const uint8_t,
+                                                            uint64_t*);
+template void SCALAR_POLYGONIZATION::classifyNodes<uint16_t>(const uint16_t*, const size_t, const int, const uint16_t,
+                                                             uint64_t*);
+template void SCALAR_POLYGONIZATION::classifyNodeRange<uint8_t>(const uint8_t*, const size_t, const int, const int,
+                                                                const uint8_t, uint64_t*);
+template void SCALAR_POLYGONIZATION::classifyNodeRange<uint16_t>(const uint16_t*, const size_t, const int, const int,
+                                                                 const uint16_t, uint64_t*);
+template bool SCALAR_POLYGONIZATION::classificationThreshold<float, float>(const float, float&);
+template bool SCALAR_POLYGONIZATION::classificationThreshold<double, double>(const double, double&);
+template bool SCALAR_POLYGONIZATION::classificationThreshold<uint8_t, float>(const float, uint8_t&);
+template bool SCALAR_POLYGONIZATION::classificationThreshold<uint16_t, float>(const float, uint16_t&);
+#if defined(SP_HAS_FLOAT16)
+template void SCALAR_POLYGONIZATION::classifyNodes<_Float16>(const _Float16*, const size_t, const int, const _Float16,
+                                                             uint64_t*);
+template void SCALAR_POLYGONIZATION::classifyNodeRange<_Float16>(const _Float16*, const size_t, const int, const int,
+                                                                 const _Float16, uint64_t*);
+template bool SCALAR_POLYGONIZATION::classificationThreshold<_Float16, float>(const float, _Float16&);
+#endif
@@ -0,0 +1,280 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright 2019 Lakshman Anumolu.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///////////////////////////////////////////////////////////////////////////////
+
+#include "scalar_polygonization/compressed_mesh.h"
+
+#include <string.h>
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace
+{
+const char MAGIC[4] = {'S', 'P', 'M', 'C'};
+constexpr uint8_t VERSION = 1;
+
+//! Edges of a cube, `4 * axis + offset` with `offset` the position of the edge along the two other axes.
+constexpr uint64_t LOCAL_EDGES = 12;
+
+//! Map signed differences to unsigned integers, small magnitudes to small integers.
+inline uint64_t zigzag(const int64_t value)
+{
+  return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+}
+
+inline int64_t unzigzag(const uint64_t value)
+{
+  return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+}
+
+class Encoder
+{
+ public:
+  void bytes(const void* data, const size_t size)
+  {
+    const uint8_t* begin = static_cast<const uint8_t*>(data);
+    m_data.insert(m_data.end(), begin, begin + size);
+  }
+
+  void varint(uint64_t value)
+  {
+    for (; value >= 0x80; value >>= 7) m_data.push_back(static_cast<uint8_t>(value | 0x80));
+    m_data.push_back(static_cast<uint8_t>(value));
+  }
+
+  std::vector<uint8_t>& data() { return m_data; }
+
+ private:
+  std::vector<uint8_t> m_data;
+};
+
+class Decoder
+{
+ public:
+  Decoder(const uint8_t* data, const size_t size) : m_data(data), m_end(data + size) {}
+
+  void bytes(void* data, const size_t size)
+  {
+    if (static_cast<size_t>(m_end - m_data) < size) corrupt();
+    memcpy(data, m_data, size);
+    m_data += size;
+  }
+
+  uint64_t varint()
+  {
+    uint64_t value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+      if (m_data == m_end) corrupt();
+      const uint8_t byte = *m_data++;
+      value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+      if (!(byte & 0x80)) return value;
+    }
+    corrupt();
+    return 0;
+  }
+
+  [[noreturn]] static void corrupt() { throw std::runtime_error("corrupt compressed mesh"); }
+
+ private:
+  const uint8_t* m_data;
+  const uint8_t* m_end;
+};
+}  // namespace
+
+template <typename T>
+std::vector<uint8_t> SCALAR_POLYGONIZATION::compressMesh(const IndexedMesh<T>& mesh, const Vec3<int>& dims,
+                                                        const Vec3<T>& origin, const Vec3<T>& spacing,
+                                                        const int weight_bits)
+{
+  if (weight_bits < 1 || weight_bits > 16) throw std::runtime_error("compressMesh needs weight_bits in [1, 16]");
+  if (mesh.edges.size() != mesh.numVertices() || mesh.weights.size() != mesh.numVertices())
+    throw std::runtime_error("compressMesh needs vertex edges, see PolygonizeOptions::vertex_edges");
+  for (int axis = 0; axis < 3; ++axis)
+    if (dims[axis] < 1) throw std::runtime_error("compressMesh needs a grid of at least one node");
+  const uint32_t max_weight = (1u << weight_bits) - 1;
+  const size_t weight_bytes = weight_bits > 8 ? 2 : 1;
+
+  Encoder encoder;
+  encoder.bytes(MAGIC, sizeof(MAGIC));
+  const uint8_t header[2] = {VERSION, static_cast<uint8_t>(weight_bits)};
+  encoder.bytes(header, sizeof(header));
+  for (int axis = 0; axis < 3; ++axis) encoder.varint(static_cast<uint64_t>(dims[axis]));
+  for (int axis = 0; axis < 3; ++axis) {
+    const double grid[2] = {static_cast<double>(origin[axis]), static_cast<double>(spacing[axis])};
+    encoder.bytes(grid, sizeof(grid));
+  }
+  encoder.varint(mesh.numVertices());
+  encoder.varint(mesh.numTriangles());
+
+  int64_t cube_dims[3];
+  for (int axis = 0; axis < 3; ++axis) cube_dims[axis] = std::max(dims[axis] - 1, 1);
+
+  int64_t previous_cube = 0;
+  for (size_t v = 0; v < mesh.numVertices(); ++v) {
+    const int edge_axis = static_cast<int>(mesh.edges[v] % 3);
+    uint64_t edge_node = mesh.edges[v] / 3;
+    int64_t node[3];
+    for (int axis = 0; axis < 3; ++axis) {
+      node[axis] = static_cast<int64_t>(edge_node % static_cast<uint64_t>(dims[axis]));
+      edge_node /= static_cast<uint64_t>(dims[axis]);
+    }
+    if (edge_node != 0 || node[edge_axis] + 1 >= dims[edge_axis])
+      throw std::runtime_error("vertex edge outside of the grid");
+    const double weight = std::min(std::max(static_cast<double>(mesh.weights[v]), 0.), 1.);
+
+    // Lowest cube holding the edge, the first one marched through it.
+    int64_t cube[3];
+    int local_edge = 4 * edge_axis;
+    for (int a = 1; a < 3; ++a) {
+      const int axis = (edge_axis + a) % 3;
+      cube[axis] = std::min<int64_t>(std::max<int64_t>(node[axis] - 1, 0), cube_dims[axis] - 1);
+      local_edge += static_cast<int>(node[axis] - cube[axis]) << (a - 1);
+    }
+    cube[edge_axis] = node[edge_axis];
+
+    const int64_t cube_index = cube[0] + cube_dims[0] * (cube[1] + cube_dims[1] * cube[2]);
+    encoder.varint(zigzag(cube_index - previous_cube) * LOCAL_EDGES + static_cast<uint64_t>(local_edge));
+    previous_cube = cube_index;
+
+    const uint32_t quantized = static_cast<uint32_t>(std::lround(weight * max_weight));
+    const uint8_t bytes[2] = {static_cast<uint8_t>(quantized), static_cast<uint8_t>(quantized >> 8)};
+    encoder.bytes(bytes, weight_bytes);
+  }
+
+  // Triangles mostly use the vertex created next or recent ones, so indices are stored relative to the next vertex.
+  int64_t next_vertex = 0;
+  for (const uint32_t index : mesh.indices) {
+    encoder.varint(zigzag(next_vertex - index));
+    next_vertex = std::max<int64_t>(next_vertex, index + int64_t(1));
+  }
+
+  return std::move(encoder.data());
+}
+
+template <typename T>
+SCALAR_POLYGONIZATION::IndexedMesh<T> SCALAR_POLYGONIZATION::decompressMesh(const uint8_t* data, const size_t size)
+{
+  Decoder decoder(data, size);
+
+  char magic[4];
+  uint8_t header[2];
+  decoder.bytes(magic, sizeof(magic));
+  decoder.bytes(header, sizeof(header));
+  if (memcmp(magic, MAGIC, sizeof(MAGIC)) || header[0] != VERSION || header[1] < 1 || header[1] > 16)
+    Decoder::corrupt();
+  const int weight_bits = header[1];
+  const double max_weight = static_cast<double>((1u << weight_bits) - 1);
+  const size_t weight_bytes = weight_bits > 8 ? 2 : 1;
+
+  uint64_t dims[3];
+  double origin[3], spacing[3];
+  for (int axis = 0; axis < 3; ++axis)
+    if ((dims[axis] = decoder.varint()) == 0 || dims[axis] > INT32_MAX) Decoder::corrupt();
+  for (int axis = 0; axis < 3; ++axis) {
+    double grid[2];
+    decoder.bytes(grid, sizeof(grid));
+    origin[axis] = grid[0];
+    spacing[axis] = grid[1];
+  }
+  const uint64_t num_vertices = decoder.varint();
+  const uint64_t num_triangles = decoder.varint();
+
+  // Every vertex and index takes at least a byte.
+  if (num_vertices > size || num_triangles > size / 3) Decoder::corrupt();
+
+  IndexedMesh<T> mesh;
+  mesh.positions.resize(num_vertices);
+  mesh.edges.resize(num_vertices);
+  mesh.weights.resize(num_vertices);
+  mesh.indices.resize(3 * num_triangles);
+
+  uint64_t cube_dims[3];
+  for (int axis = 0; axis < 3; ++axis) cube_dims[axis] = std::max<uint64_t>(dims[axis] - 1, 1);
+
+  int64_t num_cubes = 1;
+  for (int axis = 0; axis < 3; ++axis) {
+    if (cube_dims[axis] > static_cast<uint64_t>(INT64_MAX / num_cubes)) Decoder::corrupt();
+    num_cubes *= static_cast<int64_t>(cube_dims[axis]);
+  }
+
+  int64_t cube_index = 0;
+  for (size_t v = 0; v < num_vertices; ++v) {
+    const uint64_t code = decoder.varint();
+    cube_index += unzigzag(code / LOCAL_EDGES);
+    if (cube_index < 0 || cube_index >= num_cubes) Decoder::corrupt();
+    const int local_edge = static_cast<int>(code % LOCAL_EDGES);
+    uint8_t bytes[2] = {0, 0};
+    decoder.bytes(bytes, weight_bytes);
+    const uint32_t quantized = bytes[0] | bytes[1] << 8;
+    if (quantized > max_weight) Decoder::corrupt();
+    const double weight = quantized / max_weight;
+
+    uint64_t node[3];
+    uint64_t cube = static_cast<uint64_t>(cube_index);
+    for (int axis = 0; axis < 3; ++axis) {
+      node[axis] = cube % cube_dims[axis];
+      cube /= cube_dims[axis];
+    }
+    const int edge_axis = local_edge / 4;
+    for (int a = 1; a < 3; ++a) node[(edge_axis + a) % 3] += (local_edge >> (a - 1)) & 1;
+    for (int axis = 0; axis < 3; ++axis)
+      if (node[axis] + (axis == edge_axis) >= dims[axis]) Decoder::corrupt();
+
+    for (int axis = 0; axis < 3; ++axis) {
+      const double u = static_cast<double>(node[axis]) + (axis == edge_axis ? weight : 0.);
+      mesh.positions[v][axis] = static_cast<T>(origin[axis] + u * spacing[axis]);
+    }
+    mesh.edges[v] = edge_axis + 3 * (node[0] + dims[0] * (node[1] + dims[1] * node[2]));
+    mesh.weights[v] = static_cast<T>(weight);
+  }
+
+  int64_t next_vertex = 0;
+  for (auto& index : mesh.indices) {
+    const int64_t vertex = next_vertex - unzigzag(decoder.varint());
+    if (vertex < 0 || static_cast<uint64_t>(vertex) >= num_vertices) Decoder::corrupt();
+    index = static_cast<uint32_t>(vertex);
+    next_vertex = std::max(next_vertex, vertex + 1);
+  }
+
+  return mesh;
+}
+
+template std::vector<uint8_t> SCALAR_POLYGONIZATION::compressMesh<float>(const IndexedMesh<float>&, const Vec3<int>&,
+                                                                        const Vec3<float>&, const Vec3<float>&,
+                                                                        const int);
+template std::vector<uint8_t> SCALAR_POLYGONIZATION::compressMesh<double>(const IndexedMesh<double>&,
+                                                                         const Vec3<int>&, const Vec3<double>&,
+                                                                         const Vec3<double>&, const int);
+template SCALAR_POLYGONIZATION::IndexedMesh<float> SCALAR_POLYGONIZATION::decompressMesh<float>(const uint8_t*,
+                                                                                               const size_t);
+template SCALAR_POLYGONIZATION::IndexedMesh<double> SCALAR_POLYGONIZATION::decompressMesh<double>(const uint8_t*,
+                                                                                                 const size_t);
@@ -0,0 +1,85 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright 2019 Lakshman Anumolu.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///////////////////////////////////////////////////////////////////////////////
+
+#include "scalar_polygonization/edge_index_cache.h"
+
+#include <algorithm>
+
+constexpr uint32_t SCALAR_POLYGONIZATION::EdgeIndexCache::INVALID;
+
+template <typename Convention>
+SCALAR_POLYGONIZATION::EdgeIndexCache::EdgeIndexCache(const int nx, const int ny, const Convention)
+    : m_nx(static_cast<size_t>(nx)), m_ny(static_cast<size_t>(ny)), m_top(1)
+{
+  for (int p = 0; p < 2; ++p) m_planes[p].assign(3 * m_nx * m_ny, INVALID);
+
+  // Edge connects two cube vertices that differ along one axis, it starts at the one with lower coordinate.
+  for (int edge = 0; edge < 12; ++edge) {
+    const int v0 = Convention::edgeVertex(edge, 0);
+    const int v1 = Convention::edgeVertex(edge, 1);
+
+    auto& cube_edge = m_cube_edges[edge];
+    for (int axis = 0; axis < 3; ++axis)
+      if (Convention::vertexOffset(v0, axis) != Convention::vertexOffset(v1, axis)) cube_edge.slot = axis;
+
+    cube_edge.di = std::min(Convention::vertexOffset(v0, 0), Convention::vertexOffset(v1, 0));
+    cube_edge.dj = std::min(Convention::vertexOffset(v0, 1), Convention::vertexOffset(v1, 1));
+    cube_edge.top = std::min(Convention::vertexOffset(v0, 2), Convention::vertexOffset(v1, 2)) > 0;
+  }
+
+  this->updateCubeEdges();
+}
+
+SCALAR_POLYGONIZATION::EdgeIndexCache::~EdgeIndexCache()
+{
+}
+
+void SCALAR_POLYGONIZATION::EdgeIndexCache::reset()
+{
+  for (int p = 0; p < 2; ++p) std::fill(m_planes[p].begin(), m_planes[p].end(), INVALID);
+}
+
+void SCALAR_POLYGONIZATION::EdgeIndexCache::advance()
+{
+  // Old bottom plane is reused as the new top plane.
+  m_top = 1 - m_top;
+  std::fill(m_planes[m_top].begin(), m_planes[m_top].end(), INVALID);
+
+  this->updateCubeEdges();
+}
+
+void SCALAR_POLYGONIZATION::EdgeIndexCache::updateCubeEdges()
+{
+  for (int edge = 0; edge < 12; ++edge) m_cube_edges[edge].plane = m_cube_edges[edge].top ? m_top : 1 - m_top;
+}
+
+template SCALAR_POLYGONIZATION::EdgeIndexCache::EdgeIndexCache(const int, const int, const Convention1);
+template SCALAR_POLYGONIZATION::EdgeIndexCache::EdgeIndexCache(const int, const int, const Convention2);
@@ -0,0 +1,279 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright 2019 Lakshman Anumolu.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///////////////////////////////////////////////////////////////////////////////
+
+#include "scalar_polygonization/float_to_text.h"
+
+#include <stdint.h>
+#include <string.h>
+
+namespace
+{
+constexpr int MANTISSA_BITS = 23;
+constexpr int EXPONENT_BITS = 8;
+constexpr int EXPONENT_BIAS = 127;
+constexpr int POW5_INV_BITCOUNT = 59;
+constexpr int POW5_BITCOUNT = 61;
+
+//! `2^(bitlength(5^i) - 1 + POW5_INV_BITCOUNT) / 5^i + 1`.
+constexpr uint64_t POW5_INV_SPLIT[31] = {
+    576460752303423489u, 461168601842738791u, 368934881474191033u, 295147905179352826u, 472236648286964522u,
+    377789318629571618u, 302231454903657294u, 483570327845851670u, 386856262276681336u, 309485009821345069u,
+    495176015714152110u, 396140812571321688u, 316912650057057351u, 507060240091291761u, 405648192073033409u,
+    324518553658426727u, 519229685853482763u, 415383748682786211u, 332306998946228969u, 531691198313966350u,
+    425352958651173080u, 340282366920938464u, 544451787073501542u, 435561429658801234u, 348449143727040987u,
+    557518629963265579u, 446014903970612463u, 356811923176489971u, 570899077082383953u, 456719261665907162u,
+    365375409332725730u,
+};
+
+//! `5^i` normalized to `POW5_BITCOUNT` bits.
+constexpr uint64_t POW5_SPLIT[48] = {
+    1152921504606846976u, 1441151880758558720u, 1801439850948198400u, 2251799813685248000u, 1407374883553280000u,
+    1759218604441600000u, 2199023255552000000u, 1374389534720000000u, 1717986918400000000u, 2147483648000000000u,
+    1342177280000000000u, 1677721600000000000u, 2097152000000000000u, 1310720000000000000u, 1638400000000000000u,
+    2048000000000000000u, 1280000000000000000u, 1600000000000000000u, 2000000000000000000u, 1250000000000000000u,
+    1562500000000000000u, 1953125000000000000u, 1220703125000000000u, 1525878906250000000u, 1907348632812500000u,
+    1192092895507812500u, 1490116119384765625u, 1862645149230957031u, 1164153218269348144u, 1455191522836685180u,
+    1818989403545856475u, 2273736754432320594u, 1421085471520200371u, 1776356839400250464u, 2220446049250313080u,
+    1387778780781445675u, 1734723475976807094u, 2168404344971008868u, 1355252715606880542u, 1694065894508600678u,
+    2117582368135750847u, 1323488980084844279u, 1654361225106055349u, 2067951531382569187u, 1292469707114105741u,
+    1615587133892632177u, 2019483917365790221u, 1262177448353618888u,
+};
+
+//! Number of bits of `5^e`, for `0 <= e <= 3528`.
+inline int pow5Bits(const int e) { return static_cast<int>((static_cast<uint32_t>(e) * 1217359u) >> 19) + 1; }
+
+//! `floor(log10(2^e))`, for `0 <= e <= 1650`.
+inline int log10Pow2(const int e) { return static_cast<int>((static_cast<uint32_t>(e) * 78913u) >> 18); }
+
+//! `floor(log10(5^e))`, for `0 <= e <= 2620`.
+inline int log10Pow5(const int e) { return static_cast<int>((static_cast<uint32_t>(e) * 732923u) >> 20); }
+
+inline int pow5Factor(uint32_t value)
+{
+  int count = 0;
+  for (; value % 5 == 0; value /= 5) ++count;
+  return count;
+}
+
+inline bool multipleOfPowerOf5(const uint32_t value, const int p) { return pow5Factor(value) >= p; }
+
+inline bool multipleOfPowerOf2(const uint32_t value, const int p) { return (value & ((1u << p) - 1)) == 0; }
+
+//! `(m * factor) >> shift`, for `shift > 32`.
+inline uint32_t mulShift(const uint32_t m, const uint64_t factor, const int shift)
+{
+  const uint64_t low = static_cast<uint64_t>(m) * static_cast<uint32_t>(factor);
+  const uint64_t high = static_cast<uint64_t>(m) * (factor >> 32);
+  return static_cast<uint32_t>(((low >> 32) + high) >> (shift - 32));
+}
+
+/*! Shortest decimal `digits * 10^exponent` of a finite non-zero float given by its mantissa and exponent bits.
+ */
+void shortestDecimal(const uint32_t ieee_mantissa, const uint32_t ieee_exponent, uint32_t& digits, int& exponent)
+{
+  // Value is m2 * 2^e2, shifted by 2 bits to represent the halfway points to the neighbouring floats.
+  int e2;
+  uint32_t m2;
+  if (ieee_exponent == 0) {
+    e2 = 1 - EXPONENT_BIAS - MANTISSA_BITS - 2;
+    m2 = ieee_mantissa;
+  } else {
+    e2 = static_cast<int>(ieee_exponent) - EXPONENT_BIAS - MANTISSA_BITS - 2;
+    m2 = (1u << MANTISSA_BITS) | ieee_mantissa;
+  }
+  const bool accept_bounds = (m2 & 1) == 0;
+
+  // Interval [mm, mp] of reals rounding to the value mv, all times 4.
+  const uint32_t mv = 4 * m2;
+  const uint32_t mm_shift = ieee_mantissa != 0 || ieee_exponent <= 1;
+  const uint32_t mp = 4 * m2 + 2;
+  const uint32_t mm = 4 * m2 - 1 - mm_shift;
+
+  // Scale the interval to decimal, vr * 10^e10 being the value.
+  uint32_t vr, vp, vm;
+  int e10;
+  bool vm_trailing_zeros = false, vr_trailing_zeros = false;
+  uint32_t last_removed_digit = 0;
+  if (e2 >= 0) {
+    const int q = log10Pow2(e2);
+    e10 = q;
+    const int k = POW5_INV_BITCOUNT + pow5Bits(q) - 1;
+    const int i = -e2 + q + k;
+    vr = mulShift(mv, POW5_INV_SPLIT[q], i);
+    vp = mulShift(mp, POW5_INV_SPLIT[q], i);
+    vm = mulShift(mm, POW5_INV_SPLIT[q], i);
+    if (q != 0 && (vp - 1) / 10 <= vm / 10) {
+      // At least one digit is removed below, compute the last one exactly.
+      const int l = POW5_INV_BITCOUNT + pow5Bits(q - 1) - 1;
+      last_removed_digit = mulShift(mv, POW5_INV_SPLIT[q - 1], -e2 + q - 1 + l) % 10;
+    }
+    if (q <= 9) {
+      // Only one of mp, mv and mm can be a multiple of 5.
+      if (mv % 5 == 0)
+        vr_trailing_zeros = multipleOfPowerOf5(mv, q);
+      else if (accept_bounds)
+        vm_trailing_zeros = multipleOfPowerOf5(mm, q);
+      else
+        vp -= multipleOfPowerOf5(mp, q);
+    }
+  } else {
+    const int q = log10Pow5(-e2);
+    e10 = q + e2;
+    const int i = -e2 - q;
+    const int k = pow5Bits(i) - POW5_BITCOUNT;
+    int j = q - k;
+    vr = mulShift(mv, POW5_SPLIT[i], j);
+    vp = mulShift(mp, POW5_SPLIT[i], j);
+    vm = mulShift(mm, POW5_SPLIT[i], j);
+    if (q != 0 && (vp - 1) / 10 <= vm / 10) {
+      j = q - 1 - (pow5Bits(i + 1) - POW5_BITCOUNT);
+      last_removed_digit = mulShift(mv, POW5_SPLIT[i + 1], j) % 10;
+    }
+    if (q <= 1) {
+      // mv has at least q trailing zero bits, mm has mm_shift bits more than mp.
+      vr_trailing_zeros = true;
+      if (accept_bounds)
+        vm_trailing_zeros = mm_shift == 1;
+      else
+        --vp;
+    } else if (q < 31) {
+      vr_trailing_zeros = multipleOfPowerOf2(mv, q - 1);
+    }
+  }
+
+  // Remove digits while the interval still holds a shorter decimal.
+  int removed = 0;
+  if (vm_trailing_zeros || vr_trailing_zeros) {
+    for (; vp / 10 > vm / 10; ++removed) {
+      vm_trailing_zeros &= vm % 10 == 0;
+      vr_trailing_zeros &= last_removed_digit == 0;
+      last_removed_digit = vr % 10;
+      vr /= 10;
+      vp /= 10;
+      vm /= 10;
+    }
+    if (vm_trailing_zeros)
+      for (; vm % 10 == 0; ++removed) {
+        vr_trailing_zeros &= last_removed_digit == 0;
+        last_removed_digit = vr % 10;
+        vr /= 10;
+        vp /= 10;
+        vm /= 10;
+      }
+    // Round half to even when exactly halfway.
+    if (vr_trailing_zeros && last_removed_digit == 5 && vr % 2 == 0) last_removed_digit = 4;
+    digits = vr + ((vr == vm && (!accept_bounds || !vm_trailing_zeros)) || last_removed_digit >= 5);
+  } else {
+    for (; vp / 10 > vm / 10; ++removed) {
+      last_removed_digit = vr % 10;
+      vr /= 10;
+      vp /= 10;
+      vm /= 10;
+    }
+    digits = vr + (vr == vm || last_removed_digit >= 5);
+  }
+  exponent = e10 + removed;
+}
+
+//! Write `value` in decimal, returns the number of characters.
+inline size_t writeDigits(uint32_t value, char* text)
+{
+  char reversed[10];
+  size_t length = 0;
+  do {
+    reversed[length++] = static_cast<char>('0' + value % 10);
+    value /= 10;
+  } while (value);
+  for (size_t c = 0; c < length; ++c) text[c] = reversed[length - 1 - c];
+  return length;
+}
+}  // namespace
+
+size_t SCALAR_POLYGONIZATION::floatToText(const float value, char* text)
+{
+  uint32_t bits;
+  memcpy(&bits, &value, sizeof(bits));
+  const bool sign = (bits >> (MANTISSA_BITS + EXPONENT_BITS)) != 0;
+  const uint32_t ieee_mantissa = bits & ((1u << MANTISSA_BITS) - 1);
+  const uint32_t ieee_exponent = (bits >> MANTISSA_BITS) & ((1u << EXPONENT_BITS) - 1);
+
+  if (ieee_exponent == (1u << EXPONENT_BITS) - 1 && ieee_mantissa) {
+    memcpy(text, "nan", 3);
+    return 3;
+  }
+
+  char* out = text;
+  if (sign) *out++ = '-';
+  if (ieee_exponent == (1u << EXPONENT_BITS) - 1) {
+    memcpy(out, "inf", 3);
+    return static_cast<size_t>(out - text) + 3;
+  }
+  if (ieee_exponent == 0 && ieee_mantissa == 0) {
+    *out++ = '0';
+    return static_cast<size_t>(out - text);
+  }
+
+  uint32_t digits;
+  int exponent;
+  shortestDecimal(ieee_mantissa, ieee_exponent, digits, exponent);
+
+  char decimal[10];
+  const int length = static_cast<int>(writeDigits(digits, decimal));
+  const int scientific = exponent + length - 1;  // decimal exponent of the first digit
+
+  if (scientific >= 0 && scientific <= 8) {
+    // Integer part, then fraction if any.
+    const int integer = scientific + 1;
+    for (int c = 0; c < integer; ++c) *out++ = c < length ? decimal[c] : '0';
+    if (length > integer) {
+      *out++ = '.';
+      memcpy(out, decimal + integer, static_cast<size_t>(length - integer));
+      out += length - integer;
+    }
+  } else if (scientific < 0 && scientific >= -5) {
+    *out++ = '0';
+    *out++ = '.';
+    for (int c = -1; c > scientific; --c) *out++ = '0';
+    memcpy(out, decimal, static_cast<size_t>(length));
+    out += length;
+  } else {
+    *out++ = decimal[0];
+    if (length > 1) {
+      *out++ = '.';
+      memcpy(out, decimal + 1, static_cast<size_t>(length - 1));
+      out += length - 1;
+    }
+    *out++ = 'e';
+    if (scientific < 0) *out++ = '-';
+    out += writeDigits(static_cast<uint32_t>(scientific < 0 ? -scientific : scientific), out);
+  }
+  return static_cast<size_t>(out - text);
+}
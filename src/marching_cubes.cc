@@ -34,33 +34,57 @@
 
 #include <iostream>
 
-template <typename T>
-SCALAR_POLYGONIZATION::MarchingCubes<T>::MarchingCubes()
+namespace
+{
+/*! Corner of a `triangle_table` (or `case_triangles`) triangle to output as corner `i_vert`.
+ *
+ * Mirrored conventions swap two corners, so that triangles of all conventions face the same way.
+ */
+template <typename Convention>
+constexpr int cornerOrder(const int i_vert)
+{
+  return Convention::MIRRORED && i_vert ? 3 - i_vert : i_vert;
+}
+}  // namespace
+
+template <typename T, typename Convention>
+SCALAR_POLYGONIZATION::MarchingCubes<T, Convention>::MarchingCubes()
 {
 }
 
-template <typename T>
-SCALAR_POLYGONIZATION::MarchingCubes<T>::~MarchingCubes()
+template <typename T, typename Convention>
+SCALAR_POLYGONIZATION::MarchingCubes<T, Convention>::~MarchingCubes()
 {
 }
 
-template <typename T>
-std::vector<size_t> SCALAR_POLYGONIZATION::MarchingCubes<T>::vertexToEdgeIds(const std::size_t offset,
-                                                                             const std::vector<size_t>& vertex_ids)
+template <typename T, typename Convention>
+std::vector<size_t> SCALAR_POLYGONIZATION::MarchingCubes<T, Convention>::vertexToEdgeIds(
+    const std::size_t offset, const std::vector<size_t>& vertex_ids)
 {
   std::vector<size_t> edge_ids(12);
 
   for (int edge = 0; edge < 12; ++edge)
-    edge_ids[edge] = vertex_ids[edge_id_to_vertex_id_base_map[edge]] +
-                     static_cast<size_t>(edge_id_to_vertex_id_offset_map[edge]) +
-                     offset * static_cast<size_t>(edge_id_to_vertex_id_offset_map[edge]);
+    edge_ids[edge] = vertex_ids[Convention::edgeBaseVertex(edge)] +
+                     static_cast<size_t>(Convention::edgeIdOffset(edge)) +
+                     offset * static_cast<size_t>(Convention::edgeIdOffset(edge));
 
   return edge_ids;
 }
 
-template <typename T>
-T SCALAR_POLYGONIZATION::MarchingCubes<T>::edgeIntersectionWeight(const T alpha1, const T alpha2,
-                                                                  const T iso_alpha) const
+template <typename T, typename Convention>
+void SCALAR_POLYGONIZATION::MarchingCubes<T, Convention>::vertexToEdgeIds(const std::size_t offset,
+                                                                          const std::size_t* vertex_ids,
+                                                                          std::size_t* edge_ids) const
+{
+  for (int edge = 0; edge < 12; ++edge)
+    edge_ids[edge] = vertex_ids[Convention::edgeBaseVertex(edge)] +
+                     static_cast<size_t>(Convention::edgeIdOffset(edge)) +
+                     offset * static_cast<size_t>(Convention::edgeIdOffset(edge));
+}
+
+template <typename T, typename Convention>
+T SCALAR_POLYGONIZATION::MarchingCubes<T, Convention>::edgeIntersectionWeight(const T alpha1, const T alpha2,
+                                                                              const T iso_alpha) const
 {
   if (fabs(iso_alpha - alpha1) < 1e-5) {
     return 0;
@@ -74,8 +98,8 @@ T SCALAR_POLYGONIZATION::MarchingCubes<T>::edgeIntersectionWeight(const T alpha1
   return (iso_alpha - alpha1) / (alpha2 - alpha1);
 }
 
-template <typename T>
-SCALAR_POLYGONIZATION::TriangleVertexTuple_t<T> SCALAR_POLYGONIZATION::MarchingCubes<T>::marchCube(
+template <typename T, typename Convention>
+SCALAR_POLYGONIZATION::TriangleVertexTuple_t<T> SCALAR_POLYGONIZATION::MarchingCubes<T, Convention>::marchCube(
     const std::vector<Vec3<T>>& cube_vertices, const std::vector<size_t>& edge_ids, const std::vector<T>& scalars,
     const std::vector<Vec3<T>>& normals, const T iso_alpha)
 {
@@ -100,12 +124,11 @@ SCALAR_POLYGONIZATION::TriangleVertexTuple_t<T> SCALAR_POLYGONIZATION::MarchingC
 
   for (int edge = 0; edge < 12; ++edge) {
     if (edge_table[vertex_flag] & (1 << edge)) {
-      frac =
-          this->edgeIntersectionWeight(scalars[edge_connection[edge][0]], scalars[edge_connection[edge][1]], iso_alpha);
-      vertex_on_edge[edge] = cube_vertices[edge_connection[edge][0]] * (static_cast<T>(1.) - frac) +
-                             cube_vertices[edge_connection[edge][1]] * frac;
-      normal_at_vertex_on_edge[edge] =
-          normals[edge_connection[edge][0]] * (static_cast<T>(1.) - frac) + normals[edge_connection[edge][1]] * frac;
+      const int v0 = Convention::edgeVertex(edge, 0);
+      const int v1 = Convention::edgeVertex(edge, 1);
+      frac = this->edgeIntersectionWeight(scalars[v0], scalars[v1], iso_alpha);
+      vertex_on_edge[edge] = cube_vertices[v0] * (static_cast<T>(1.) - frac) + cube_vertices[v1] * frac;
+      normal_at_vertex_on_edge[edge] = normals[v0] * (static_cast<T>(1.) - frac) + normals[v1] * frac;
     }
   }
 
@@ -114,7 +137,7 @@ SCALAR_POLYGONIZATION::TriangleVertexTuple_t<T> SCALAR_POLYGONIZATION::MarchingC
     Triangle<T> triangle;
     for (int i_vert = 0; i_vert < 3; ++i_vert) {
       Vertex<T> vertex;
-      auto vertex_idx = triangle_table[vertex_flag][i_tri + i_vert];
+      auto vertex_idx = triangle_table[vertex_flag][i_tri + cornerOrder<Convention>(i_vert)];
       vertex.pos = vertex_on_edge[vertex_idx];
       vertex.normal = normal_at_vertex_on_edge[vertex_idx];
       vertex.id = edge_ids[vertex_idx];  // id of the edge.
@@ -134,4 +157,58 @@ SCALAR_POLYGONIZATION::TriangleVertexTuple_t<T> SCALAR_POLYGONIZATION::MarchingC
   return triangle_vertex_tuple;
 }
 
-template class SCALAR_POLYGONIZATION::MarchingCubes<float>;
+template <typename T, typename Convention>
+int SCALAR_POLYGONIZATION::MarchingCubes<T, Convention>::marchCube(const Vec3<T>* cube_vertices, const T* scalars,
+                                                                  const Vec3<T>* normals, const T iso_alpha,
+                                                                  CubeTriangulation<T>& triangulation) const
+{
+  triangulation.num_triangles = 0;
+  triangulation.num_vertices = 0;
+
+  // Find which cube_vertices are inside of the surface and which are outside.
+  int vertex_flag = 0;
+  for (int i = 0; i < 8; ++i)
+    if (scalars[i] < iso_alpha) vertex_flag |= (1 << i);
+
+  // If the cube is entirely inside or outside of the surface, then there will be no intersections.
+  const int num_vertices = case_edge_count[vertex_flag];
+  if (num_vertices == 0) return 0;
+
+  // One vertex per intersected edge, in the order of `case_edges`, so that `case_triangles` indexes them directly.
+  const uint8_t* edges = case_edges[vertex_flag];
+  for (int n = 0; n < num_vertices; ++n) {
+    const int edge = edges[n];
+    const int v0 = Convention::edgeVertex(edge, 0);
+    const int v1 = Convention::edgeVertex(edge, 1);
+    const T frac = this->edgeIntersectionWeight(scalars[v0], scalars[v1], iso_alpha);
+    const T one_minus_frac = static_cast<T>(1.) - frac;
+
+    triangulation.edges[n] = edge;
+    triangulation.weights[n] = frac;
+
+    auto& position = triangulation.positions[n];
+    for (int axis = 0; axis < 3; ++axis)
+      position[axis] = cube_vertices[v0][axis] * one_minus_frac + cube_vertices[v1][axis] * frac;
+
+    auto& normal = triangulation.normals[n];
+    for (int axis = 0; axis < 3; ++axis)
+      normal[axis] = normals ? normals[v0][axis] * one_minus_frac + normals[v1][axis] * frac : static_cast<T>(0.);
+  }
+  triangulation.num_vertices = num_vertices;
+
+  // Create triangles.
+  const int num_triangles = triangle_count_table[vertex_flag];
+  const uint8_t* corners = case_triangles[vertex_flag];
+  for (int i_tri = 0; i_tri < 3 * num_triangles; i_tri += 3)
+    for (int i_vert = 0; i_vert < 3; ++i_vert)
+      triangulation.triangles[i_tri + i_vert] = corners[i_tri + cornerOrder<Convention>(i_vert)];
+
+  triangulation.num_triangles = num_triangles;
+
+  return triangulation.num_triangles;
+}
+
+template class SCALAR_POLYGONIZATION::MarchingCubes<float, SCALAR_POLYGONIZATION::Convention1>;
+template class SCALAR_POLYGONIZATION::MarchingCubes<float, SCALAR_POLYGONIZATION::Convention2>;
+template class SCALAR_POLYGONIZATION::MarchingCubes<double, SCALAR_POLYGONIZATION::Convention1>;
+template class SCALAR_POLYGONIZATION::MarchingCubes<double, SCALAR_POLYGONIZATION::Convention2>;
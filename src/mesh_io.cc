@@ -0,0 +1,381 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright 2019 Lakshman Anumolu.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///////////////////////////////////////////////////////////////////////////////
+
+#include "scalar_polygonization/mesh_io.h"
+#include "scalar_polygonization/float_to_text.h"
+#include "scalar_polygonization/parallel.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+/*! Output file written in blocks of `BLOCK_SIZE` bytes.
+ */
+class BlockWriter
+{
+ public:
+  static constexpr size_t BLOCK_SIZE = 1 << 22;
+
+  explicit BlockWriter(const std::string& file_name)
+      : m_file_name(file_name), m_file(file_name, std::ios::binary), m_block(BLOCK_SIZE), m_size(0)
+  {
+    if (!m_file) throw std::runtime_error("cannot open " + file_name);
+  }
+
+  //! Room for at least `size` more bytes in the block, `size` must not exceed `BLOCK_SIZE`.
+  char* reserve(const size_t size)
+  {
+    if (m_size + size > BLOCK_SIZE) this->flush();
+    return &m_block[m_size];
+  }
+
+  //! Keep `size` bytes written at `reserve`.
+  void commit(const size_t size) { m_size += size; }
+
+  void append(const void* data, const size_t size)
+  {
+    const char* bytes = static_cast<const char*>(data);
+    for (size_t done = 0; done < size;) {
+      const size_t count = std::min(size - done, BLOCK_SIZE - m_size);
+      memcpy(&m_block[m_size], bytes + done, count);
+      m_size += count;
+      done += count;
+      if (m_size == BLOCK_SIZE) this->flush();
+    }
+  }
+
+  void append(const std::string& text) { this->append(text.data(), text.size()); }
+
+  //! Write the last block and check that all writes succeeded.
+  void close()
+  {
+    this->flush();
+    m_file.close();
+    if (!m_file) throw std::runtime_error("cannot write " + m_file_name);
+  }
+
+ private:
+  void flush()
+  {
+    m_file.write(m_block.data(), static_cast<std::streamsize>(m_size));
+    m_size = 0;
+  }
+
+  const std::string m_file_name;
+  std::ofstream m_file;
+  std::vector<char> m_block;
+  size_t m_size;  //!< bytes used in m_block
+};
+
+constexpr size_t BlockWriter::BLOCK_SIZE;
+
+//! Store a 32 bit value least significant byte first, whatever the byte order of the host.
+void storeLittleEndian(const uint32_t value, char* bytes)
+{
+  for (int n = 0; n < 4; ++n) bytes[n] = static_cast<char>((value >> (8 * n)) & 0xff);
+}
+
+//! Store a 64 bit value least significant byte first, whatever the byte order of the host.
+void storeLittleEndian(const uint64_t value, char* bytes)
+{
+  for (int n = 0; n < 8; ++n) bytes[n] = static_cast<char>((value >> (8 * n)) & 0xff);
+}
+
+//! Store a float as its IEEE 754 bits, least significant byte first.
+void storeLittleEndian(const float value, char* bytes)
+{
+  static_assert(sizeof(float) == sizeof(uint32_t), "floats are 32 bit");
+  uint32_t bits;
+  memcpy(&bits, &value, sizeof(bits));
+  storeLittleEndian(bits, bytes);
+}
+
+//! Store a double as its IEEE 754 bits, least significant byte first.
+void storeLittleEndian(const double value, char* bytes)
+{
+  static_assert(sizeof(double) == sizeof(uint64_t), "doubles are 64 bit");
+  uint64_t bits;
+  memcpy(&bits, &value, sizeof(bits));
+  storeLittleEndian(bits, bytes);
+}
+
+constexpr size_t OBJ_CHUNK_LINES = 1 << 13;  //!< lines formatted by one task
+constexpr size_t OBJ_MAX_LINE = 96;          //!< characters of the longest OBJ line
+constexpr size_t OBJ_BATCH_CHUNKS = 32;      //!< chunks formatted before writing
+
+//! Write a float with the fewest digits reading back exactly, returns the number of characters.
+inline size_t numberToText(const float value, char* text) { return SCALAR_POLYGONIZATION::floatToText(value, text); }
+
+//! Write a double with 17 significant digits, returns the number of characters.
+inline size_t numberToText(const double value, char* text)
+{
+  return static_cast<size_t>(snprintf(text, 32, "%.17g", value));
+}
+
+//! Write an index in decimal, returns the number of characters.
+inline size_t indexToText(uint64_t value, char* text)
+{
+  char reversed[20];
+  size_t length = 0;
+  do {
+    reversed[length++] = static_cast<char>('0' + value % 10);
+    value /= 10;
+  } while (value);
+  for (size_t c = 0; c < length; ++c) text[c] = reversed[length - 1 - c];
+  return length;
+}
+
+//! Write all bytes of `count` buffers, returns false on error.
+bool writeAll(const int fd, iovec* buffers, size_t count)
+{
+  while (count) {
+    const ssize_t written = ::writev(fd, buffers, static_cast<int>(std::min<size_t>(count, IOV_MAX)));
+    if (written < 0) {
+      if (errno == EINTR) continue;
+      return false;
+    }
+
+    // Skip the buffers written, and the written part of a partially written one.
+    size_t remaining = static_cast<size_t>(written);
+    for (; count && remaining >= buffers->iov_len; ++buffers, --count) remaining -= buffers->iov_len;
+    if (count) {
+      buffers->iov_base = static_cast<char*>(buffers->iov_base) + remaining;
+      buffers->iov_len -= remaining;
+    }
+  }
+  return true;
+}
+
+template <typename T>
+const char* plyType();
+
+template <>
+const char* plyType<float>()
+{
+  return "float";
+}
+
+template <>
+const char* plyType<double>()
+{
+  return "double";
+}
+}  // namespace
+
+template <typename T, typename I>
+void SCALAR_POLYGONIZATION::writePly(const std::string& file_name, const IndexedMesh<T, I>& mesh)
+{
+  if (mesh.numVertices() > UINT32_MAX) throw std::runtime_error("too many vertices for PLY: " + file_name);
+
+  const bool has_normals = mesh.normals.size() == mesh.numVertices();
+  const std::string type = plyType<T>();
+
+  BlockWriter writer(file_name);
+
+  // Values are stored byte by byte in little endian order, whatever the byte order of the host.
+  writer.append("ply\nformat binary_little_endian 1.0\nelement vertex " + std::to_string(mesh.numVertices()) +
+                "\nproperty " + type + " x\nproperty " + type + " y\nproperty " + type + " z\n");
+  if (has_normals)
+    writer.append("property " + type + " nx\nproperty " + type + " ny\nproperty " + type + " nz\n");
+  writer.append("element face " + std::to_string(mesh.numTriangles()) +
+                "\nproperty list uchar uint vertex_indices\nend_header\n");
+
+  // Vertex records, position then normal.
+  const size_t vertex_size = (has_normals ? 6 : 3) * sizeof(T);
+  for (size_t v = 0; v < mesh.numVertices(); ++v) {
+    char* record = writer.reserve(vertex_size);
+    for (int axis = 0; axis < 3; ++axis) {
+      storeLittleEndian(mesh.positions[v][axis], record + axis * sizeof(T));
+      if (has_normals) storeLittleEndian(mesh.normals[v][axis], record + (3 + axis) * sizeof(T));
+    }
+    writer.commit(vertex_size);
+  }
+
+  // Face records, a count of 3 then the vertex indices.
+  const size_t face_size = 1 + 3 * sizeof(uint32_t);
+  for (size_t t = 0; t < mesh.numTriangles(); ++t) {
+    char* record = writer.reserve(face_size);
+    record[0] = 3;
+    for (int c = 0; c < 3; ++c)
+      storeLittleEndian(static_cast<uint32_t>(mesh.indices[3 * t + c]), record + 1 + c * sizeof(uint32_t));
+    writer.commit(face_size);
+  }
+
+  writer.close();
+}
+
+template <typename T, typename I>
+void SCALAR_POLYGONIZATION::writeStl(const std::string& file_name, const IndexedMesh<T, I>& mesh)
+{
+  if (mesh.numTriangles() > UINT32_MAX) throw std::runtime_error("too many triangles for STL: " + file_name);
+
+  BlockWriter writer(file_name);
+
+  // STL is little endian, values are stored byte by byte.
+  char header[80] = "binary STL written by scalar_polygonization";
+  writer.append(header, sizeof(header));
+  char num_triangles[sizeof(uint32_t)];
+  storeLittleEndian(static_cast<uint32_t>(mesh.numTriangles()), num_triangles);
+  writer.append(num_triangles, sizeof(num_triangles));
+
+  // Triangle records: normal, three vertices and a zero attribute byte count.
+  const size_t triangle_size = 12 * sizeof(float) + sizeof(uint16_t);
+  for (size_t t = 0; t < mesh.numTriangles(); ++t) {
+    const auto& p0 = mesh.positions[mesh.indices[3 * t]];
+    const auto& p1 = mesh.positions[mesh.indices[3 * t + 1]];
+    const auto& p2 = mesh.positions[mesh.indices[3 * t + 2]];
+    const auto e1 = p1 - p0, e2 = p2 - p0;
+    Vec3<T> normal(e1[1] * e2[2] - e1[2] * e2[1], e1[2] * e2[0] - e1[0] * e2[2], e1[0] * e2[1] - e1[1] * e2[0]);
+    normal.normalize();
+
+    float values[12];
+    for (int axis = 0; axis < 3; ++axis) {
+      values[axis] = static_cast<float>(normal[axis]);
+      values[3 + axis] = static_cast<float>(p0[axis]);
+      values[6 + axis] = static_cast<float>(p1[axis]);
+      values[9 + axis] = static_cast<float>(p2[axis]);
+    }
+
+    char* record = writer.reserve(triangle_size);
+    for (int n = 0; n < 12; ++n) storeLittleEndian(values[n], record + n * sizeof(float));
+    memset(record + sizeof(values), 0, sizeof(uint16_t));
+    writer.commit(triangle_size);
+  }
+
+  writer.close();
+}
+
+template <typename T, typename I>
+void SCALAR_POLYGONIZATION::writeObj(const std::string& file_name, const IndexedMesh<T, I>& mesh,
+                                     const unsigned num_threads)
+{
+  const bool has_normals = mesh.normals.size() == mesh.numVertices();
+
+  // Chunks of vertex lines, then normal lines, then face lines.
+  const size_t vertex_chunks = (mesh.numVertices() + OBJ_CHUNK_LINES - 1) / OBJ_CHUNK_LINES;
+  const size_t normal_chunks = has_normals ? vertex_chunks : 0;
+  const size_t face_chunks = (mesh.numTriangles() + OBJ_CHUNK_LINES - 1) / OBJ_CHUNK_LINES;
+  const size_t num_chunks = vertex_chunks + normal_chunks + face_chunks;
+
+  auto formatChunk = [&](const size_t chunk, char* text) -> size_t {
+    char* out = text;
+    if (chunk < vertex_chunks + normal_chunks) {
+      const bool normals = chunk >= vertex_chunks;
+      const auto& values = normals ? mesh.normals : mesh.positions;
+      const size_t begin = (normals ? chunk - vertex_chunks : chunk) * OBJ_CHUNK_LINES;
+      const size_t end = std::min(begin + OBJ_CHUNK_LINES, values.size());
+      for (size_t v = begin; v < end; ++v) {
+        *out++ = 'v';
+        if (normals) *out++ = 'n';
+        for (int axis = 0; axis < 3; ++axis) {
+          *out++ = ' ';
+          out += numberToText(values[v][axis], out);
+        }
+        *out++ = '\n';
+      }
+    } else {
+      // OBJ indices start at 1.
+      const size_t begin = (chunk - vertex_chunks - normal_chunks) * OBJ_CHUNK_LINES;
+      const size_t end = std::min(begin + OBJ_CHUNK_LINES, mesh.numTriangles());
+      for (size_t t = begin; t < end; ++t) {
+        *out++ = 'f';
+        for (int c = 0; c < 3; ++c) {
+          const uint64_t index = static_cast<uint64_t>(mesh.indices[3 * t + c]) + 1;
+          *out++ = ' ';
+          out += indexToText(index, out);
+          if (!has_normals) continue;
+          *out++ = '/';
+          *out++ = '/';
+          out += indexToText(index, out);
+        }
+        *out++ = '\n';
+      }
+    }
+    return static_cast<size_t>(out - text);
+  };
+
+  const int fd = ::open(file_name.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (fd < 0) throw std::runtime_error("cannot open " + file_name);
+
+  // Format a batch of chunks in parallel, then write the batch with one system call per IOV_MAX chunks.
+  std::vector<std::unique_ptr<char[]>> buffers(std::min(num_chunks, OBJ_BATCH_CHUNKS));
+  std::vector<iovec> batch(buffers.size());
+  bool written = true;
+  for (size_t first = 0; first < num_chunks && written; first += OBJ_BATCH_CHUNKS) {
+    const size_t count = std::min(OBJ_BATCH_CHUNKS, num_chunks - first);
+    parallelFor(count, num_threads, [&](const size_t c) {
+      if (!buffers[c]) buffers[c].reset(new char[OBJ_CHUNK_LINES * OBJ_MAX_LINE]);
+      batch[c].iov_base = buffers[c].get();
+      batch[c].iov_len = formatChunk(first + c, buffers[c].get());
+    });
+    written = writeAll(fd, batch.data(), count);
+  }
+
+  written = ::close(fd) == 0 && written;
+  if (!written) throw std::runtime_error("cannot write " + file_name);
+}
+
+template void SCALAR_POLYGONIZATION::writePly<float, uint32_t>(const std::string&,
+                                                               const IndexedMesh<float, uint32_t>&);
+template void SCALAR_POLYGONIZATION::writePly<float, uint64_t>(const std::string&,
+                                                               const IndexedMesh<float, uint64_t>&);
+template void SCALAR_POLYGONIZATION::writePly<double, uint32_t>(const std::string&,
+                                                                const IndexedMesh<double, uint32_t>&);
+template void SCALAR_POLYGONIZATION::writePly<double, uint64_t>(const std::string&,
+                                                                const IndexedMesh<double, uint64_t>&);
+template void SCALAR_POLYGONIZATION::writeStl<float, uint32_t>(const std::string&,
+                                                               const IndexedMesh<float, uint32_t>&);
+template void SCALAR_POLYGONIZATION::writeStl<float, uint64_t>(const std::string&,
+                                                               const IndexedMesh<float, uint64_t>&);
+template void SCALAR_POLYGONIZATION::writeStl<double, uint32_t>(const std::string&,
+                                                                const IndexedMesh<double, uint32_t>&);
+template void SCALAR_POLYGONIZATION::writeStl<double, uint64_t>(const std::string&,
+                                                                const IndexedMesh<double, uint64_t>&);
+template void SCALAR_POLYGONIZATION::writeObj<float, uint32_t>(const std::string&,
+                                                               const IndexedMesh<float, uint32_t>&, const unsigned);
+template void SCALAR_POLYGONIZATION::writeObj<float, uint64_t>(const std::string&,
+                                                               const IndexedMesh<float, uint64_t>&, const unsigned);
+template void SCALAR_POLYGONIZATION::writeObj<double, uint32_t>(const std::string&,
+                                                                const IndexedMesh<double, uint32_t>&, const unsigned);
+template void SCALAR_POLYGONIZATION::writeObj<double, uint64_t>(const std::string&,
+                                                                const IndexedMesh<double, uint64_t>&, const unsigned);
@@ -0,0 +1,1135 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright 2019 Lakshman Anumolu.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///////////////////////////////////////////////////////////////////////////////
+
+#include "scalar_polygonization/polygonize_volume.h"
+#include "scalar_polygonization/brick_min_max.h"
+#include "scalar_polygonization/classification.h"
+#include "scalar_polygonization/edge_index_cache.h"
+#include "scalar_polygonization/marching_cubes.h"
+#include "scalar_polygonization/parallel.h"
+#include "scalar_polygonization/polygonize_function.h"
+#include "scalar_polygonization/polygonize_stream.h"
+#include "scalar_polygonization/tables.h"
+
+#include <array>
+#include <assert.h>
+#include <cmath>
+#include <functional>
+#include <stdexcept>
+#include <string.h>
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+template <typename T, typename S>
+SCALAR_POLYGONIZATION::ScalarVolume<T, S>::ScalarVolume(const S* data, const Vec3<int>& dims,
+                                                        const Vec3<size_t>& strides, const int ghost,
+                                                        const Vec3<T>& origin, const Vec3<T>& spacing)
+    : m_data(data), m_ghost(ghost)
+{
+  for (int axis = 0; axis < 3; ++axis) {
+    m_dims[axis] = dims[axis];
+    m_strides[axis] = strides[axis];
+    m_origin[axis] = origin[axis];
+    m_spacing[axis] = spacing[axis];
+  }
+}
+
+template <typename T, typename S>
+SCALAR_POLYGONIZATION::ScalarVolume<T, S>::ScalarVolume(const S* data, const Vec3<int>& dims, const Vec3<T>& origin,
+                                                        const Vec3<T>& spacing)
+    : ScalarVolume(data, dims,
+                   Vec3<size_t>(1, static_cast<size_t>(dims[0]), static_cast<size_t>(dims[0]) * dims[1]), 0,
+                   origin, spacing)
+{
+}
+
+template <typename T, typename I>
+void SCALAR_POLYGONIZATION::IndexedMesh<T, I>::clear()
+{
+  positions.clear();
+  normals.clear();
+  indices.clear();
+  edges.clear();
+  weights.clear();
+}
+
+namespace
+{
+constexpr size_t NORMAL_CHUNK_TRIANGLES = 1 << 14;  //!< Triangles summed by one task.
+constexpr size_t NORMAL_BLOCK_VERTICES = 1 << 10;   //!< Vertices gathered and normalized by one task.
+
+/*! Add weighted normals of triangles [begin, end) to `sums[3 * (vertex - first) + axis]`.
+ *
+ * Positions are read as a flat array of coordinates, `Vec3` arithmetic is not inlined.
+ */
+template <typename T, typename I>
+void sumTriangleNormals(const T* positions, const I* indices, const SCALAR_POLYGONIZATION::NormalWeighting weighting,
+                        const size_t begin, const size_t end, const size_t first, T* sums)
+{
+  for (size_t t = begin; t < end; ++t) {
+    const T* p[3] = {positions + 3 * indices[3 * t], positions + 3 * indices[3 * t + 1],
+                     positions + 3 * indices[3 * t + 2]};
+    T* s[3] = {sums + 3 * (indices[3 * t] - first), sums + 3 * (indices[3 * t + 1] - first),
+               sums + 3 * (indices[3 * t + 2] - first)};
+
+    const T e1[3] = {p[1][0] - p[0][0], p[1][1] - p[0][1], p[1][2] - p[0][2]};
+    const T e2[3] = {p[2][0] - p[0][0], p[2][1] - p[0][1], p[2][2] - p[0][2]};
+
+    // Length of the cross product is twice the area of the triangle.
+    const T normal[3] = {e1[1] * e2[2] - e1[2] * e2[1], e1[2] * e2[0] - e1[0] * e2[2], e1[0] * e2[1] - e1[1] * e2[0]};
+
+    if (weighting == SCALAR_POLYGONIZATION::NormalWeighting::AREA) {
+      for (int c = 0; c < 3; ++c)
+        for (int axis = 0; axis < 3; ++axis) s[c][axis] += normal[axis];
+      continue;
+    }
+
+    // Angle at a corner from the sine and cosine of its two edges: the cross product has the same length for all.
+    const T length = std::sqrt(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]);
+    if (length == 0) continue;
+    for (int c = 0; c < 3; ++c) {
+      const T* q = p[(c + 1) % 3];
+      const T* r = p[(c + 2) % 3];
+      const T dot = (q[0] - p[c][0]) * (r[0] - p[c][0]) + (q[1] - p[c][1]) * (r[1] - p[c][1]) +
+                    (q[2] - p[c][2]) * (r[2] - p[c][2]);
+      const T weight = std::atan2(length, dot) / length;
+      for (int axis = 0; axis < 3; ++axis) s[c][axis] += normal[axis] * weight;
+    }
+  }
+}
+
+/*! Divide vectors (x[v], y[v], z[v]) by their length, vectors of length 0 are left unchanged.
+ */
+template <typename T>
+void normalizeVectors(T* x, T* y, T* z, const size_t begin, const size_t end)
+{
+  for (size_t v = begin; v < end; ++v) {
+    const T length = std::sqrt(x[v] * x[v] + y[v] * y[v] + z[v] * z[v]);
+    if (length > 0) {
+      x[v] /= length;
+      y[v] /= length;
+      z[v] /= length;
+    }
+  }
+}
+
+#if defined(__SSE2__)
+void normalizeVectors(float* x, float* y, float* z, const size_t begin, const size_t end)
+{
+  size_t v = begin;
+  for (; v + 4 <= end; v += 4) {
+    const __m128 vx = _mm_loadu_ps(x + v), vy = _mm_loadu_ps(y + v), vz = _mm_loadu_ps(z + v);
+    const __m128 squared = _mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, vx), _mm_mul_ps(vy, vy)), _mm_mul_ps(vz, vz));
+    const __m128 length = _mm_sqrt_ps(squared);
+    const __m128 positive = _mm_cmpgt_ps(length, _mm_setzero_ps());
+    _mm_storeu_ps(x + v, _mm_or_ps(_mm_and_ps(positive, _mm_div_ps(vx, length)), _mm_andnot_ps(positive, vx)));
+    _mm_storeu_ps(y + v, _mm_or_ps(_mm_and_ps(positive, _mm_div_ps(vy, length)), _mm_andnot_ps(positive, vy)));
+    _mm_storeu_ps(z + v, _mm_or_ps(_mm_and_ps(positive, _mm_div_ps(vz, length)), _mm_andnot_ps(positive, vz)));
+  }
+  normalizeVectors<float>(x, y, z, v, end);
+}
+
+void normalizeVectors(double* x, double* y, double* z, const size_t begin, const size_t end)
+{
+  size_t v = begin;
+  for (; v + 2 <= end; v += 2) {
+    const __m128d vx = _mm_loadu_pd(x + v), vy = _mm_loadu_pd(y + v), vz = _mm_loadu_pd(z + v);
+    const __m128d squared = _mm_add_pd(_mm_add_pd(_mm_mul_pd(vx, vx), _mm_mul_pd(vy, vy)), _mm_mul_pd(vz, vz));
+    const __m128d length = _mm_sqrt_pd(squared);
+    const __m128d positive = _mm_cmpgt_pd(length, _mm_setzero_pd());
+    _mm_storeu_pd(x + v, _mm_or_pd(_mm_and_pd(positive, _mm_div_pd(vx, length)), _mm_andnot_pd(positive, vx)));
+    _mm_storeu_pd(y + v, _mm_or_pd(_mm_and_pd(positive, _mm_div_pd(vy, length)), _mm_andnot_pd(positive, vy)));
+    _mm_storeu_pd(z + v, _mm_or_pd(_mm_and_pd(positive, _mm_div_pd(vz, length)), _mm_andnot_pd(positive, vz)));
+  }
+  normalizeVectors<double>(x, y, z, v, end);
+}
+#endif
+}  // namespace
+
+template <typename T, typename I>
+void SCALAR_POLYGONIZATION::computeVertexNormals(IndexedMesh<T, I>& mesh, const NormalWeighting weighting,
+                                                 const unsigned num_threads)
+{
+  if (weighting == NormalWeighting::NONE) {
+    mesh.normals.clear();
+    return;
+  }
+
+  const size_t num_vertices = mesh.numVertices();
+  const size_t num_triangles = mesh.numTriangles();
+
+  // Range of vertices used by each chunk of triangles.
+  size_t num_chunks = (num_triangles + NORMAL_CHUNK_TRIANGLES - 1) / NORMAL_CHUNK_TRIANGLES;
+  std::vector<size_t> first(num_chunks, num_vertices), last(num_chunks, 0);
+  parallelFor(num_chunks, num_threads, [&](const size_t c) {
+    const size_t end = 3 * std::min((c + 1) * NORMAL_CHUNK_TRIANGLES, num_triangles);
+    for (size_t i = 3 * c * NORMAL_CHUNK_TRIANGLES; i < end; ++i) {
+      first[c] = std::min(first[c], static_cast<size_t>(mesh.indices[i]));
+      last[c] = std::max(last[c], static_cast<size_t>(mesh.indices[i]) + 1);
+    }
+  });
+
+  // Chunks of a mesh with scattered indices would each hold most vertices, sum all triangles in one chunk instead.
+  size_t sum_size = 0;
+  for (size_t c = 0; c < num_chunks; ++c) sum_size += last[c] - first[c];
+  if (num_chunks > 1 && sum_size > 4 * num_vertices) {
+    num_chunks = 1;
+    first.assign(1, 0);
+    last.assign(1, num_vertices);
+  }
+
+  static_assert(sizeof(Vec3<T>) == 3 * sizeof(T), "Vec3 arrays are read as arrays of coordinates");
+  const T* positions = reinterpret_cast<const T*>(mesh.positions.data());
+
+  std::vector<std::vector<T>> sums(num_chunks);
+  parallelFor(num_chunks, num_threads, [&](const size_t c) {
+    if (first[c] >= last[c]) return;
+    sums[c].assign(3 * (last[c] - first[c]), 0);
+    const size_t begin = num_chunks > 1 ? c * NORMAL_CHUNK_TRIANGLES : 0;
+    const size_t end = num_chunks > 1 ? std::min(begin + NORMAL_CHUNK_TRIANGLES, num_triangles) : num_triangles;
+    sumTriangleNormals(positions, mesh.indices.data(), weighting, begin, end, first[c], sums[c].data());
+  });
+
+  // Gather each block of vertices from overlapping chunks in chunk order, then normalize it.
+  mesh.normals.resize(num_vertices);
+  T* normals = reinterpret_cast<T*>(mesh.normals.data());
+  const size_t num_blocks = (num_vertices + NORMAL_BLOCK_VERTICES - 1) / NORMAL_BLOCK_VERTICES;
+  parallelFor(num_blocks, num_threads, [&](const size_t b) {
+    const size_t begin = b * NORMAL_BLOCK_VERTICES;
+    const size_t end = std::min(begin + NORMAL_BLOCK_VERTICES, num_vertices);
+
+    T x[NORMAL_BLOCK_VERTICES] = {}, y[NORMAL_BLOCK_VERTICES] = {}, z[NORMAL_BLOCK_VERTICES] = {};
+    for (size_t c = 0; c < num_chunks; ++c) {
+      const size_t overlap_begin = std::max(begin, first[c]), overlap_end = std::min(end, last[c]);
+      for (size_t v = overlap_begin; v < overlap_end; ++v) {
+        const T* sum = &sums[c][3 * (v - first[c])];
+        x[v - begin] += sum[0];
+        y[v - begin] += sum[1];
+        z[v - begin] += sum[2];
+      }
+    }
+
+    normalizeVectors(x, y, z, 0, end - begin);
+    for (size_t v = begin; v < end; ++v) {
+      normals[3 * v] = x[v - begin];
+      normals[3 * v + 1] = y[v - begin];
+      normals[3 * v + 2] = z[v - begin];
+    }
+  });
+}
+
+namespace
+{
+//! Marks a vertex index owned by the previous slab, remaining bits give the edge in its top plane.
+const uint32_t SEAM = 0x80000000u;
+
+//! Largest number of vertices of a mesh with 32 bit indices.
+const uint64_t MAX_VERTICES = static_cast<uint64_t>(UINT32_MAX) + 1;
+
+/*! Consecutive layers of cubes polygonized by one task.
+ */
+template <typename T>
+struct Slab {
+  int k_begin;                                             //!< First layer of cubes.
+  int k_end;                                               //!< One past the last layer of cubes.
+  std::vector<SCALAR_POLYGONIZATION::Vec3<T>> positions;  //!< Vertices created by this slab.
+  std::vector<uint64_t> edges;                             //!< Grid edge of each vertex, if requested.
+  std::vector<T> weights;                                  //!< Position of each vertex along its edge, if requested.
+  std::vector<uint32_t> indices;                           //!< Slab local vertex indices, or `SEAM` coded.
+  std::vector<uint32_t> top_plane;                         //!< Slab local vertex indices on top node plane.
+  size_t num_vertices;                                     //!< Number of vertices created by this slab.
+  size_t num_indices;                                      //!< Number of vertex indices of triangles.
+};
+
+/*! Largest number of vertices a slab can create.
+ *
+ * Slab local indices of slabs above the first one must not look `SEAM` coded, and none may be
+ * `EdgeIndexCache::INVALID`.
+ */
+template <typename T>
+size_t maxSlabVertices(const Slab<T>& slab)
+{
+  return slab.k_begin > 0 ? SEAM : SCALAR_POLYGONIZATION::EdgeIndexCache::INVALID;
+}
+
+/*! Throw `std::overflow_error` if a mesh has too many vertices for 32 bit indices.
+ */
+inline void checkNumVertices(const size_t num_vertices)
+{
+  if (num_vertices > MAX_VERTICES) throw std::overflow_error("too many vertices for 32 bit indices");
+}
+
+/*! Output of `polygonizeSlab` appending to the vectors of the slab.
+ */
+template <typename T>
+class GrowingOutput
+{
+ public:
+  GrowingOutput(Slab<T>& slab, const bool vertex_edges)
+      : m_slab(slab), m_vertex_edges(vertex_edges), m_max_vertices(maxSlabVertices(slab))
+  {
+  }
+
+  uint32_t addVertex(const SCALAR_POLYGONIZATION::Vec3<T>& position, const uint64_t edge, const T weight)
+  {
+    if (m_slab.positions.size() >= m_max_vertices) throw std::overflow_error("too many vertices in a slab");
+    m_slab.positions.push_back(position);
+    if (m_vertex_edges) {
+      m_slab.edges.push_back(edge);
+      m_slab.weights.push_back(weight);
+    }
+    return static_cast<uint32_t>(m_slab.positions.size() - 1);
+  }
+
+  void addIndex(const uint32_t vertex) { m_slab.indices.push_back(vertex); }
+
+  void endLayer() {}
+
+  size_t numVertices() const { return m_slab.positions.size(); }
+  size_t numIndices() const { return m_slab.indices.size(); }
+
+ private:
+  Slab<T>& m_slab;
+  const bool m_vertex_edges;
+  const size_t m_max_vertices;
+};
+
+/*! Output of `polygonizeSlab` writing into preallocated arrays.
+ *
+ * Vertex indices are written slab local, like `GrowingOutput`, and offset while stitching. Edges and weights are
+ * written if their arrays are given. Arrays are sized from `countSlab`, whose counts are checked beforehand.
+ */
+template <typename T>
+class FixedOutput
+{
+ public:
+  FixedOutput(SCALAR_POLYGONIZATION::Vec3<T>* positions, uint32_t* indices, uint64_t* edges, T* weights)
+      : m_positions(positions), m_indices(indices), m_edges(edges), m_weights(weights), m_num_vertices(0),
+        m_num_indices(0)
+  {
+  }
+
+  uint32_t addVertex(const SCALAR_POLYGONIZATION::Vec3<T>& position, const uint64_t edge, const T weight)
+  {
+    m_positions[m_num_vertices] = position;
+    if (m_edges) {
+      m_edges[m_num_vertices] = edge;
+      m_weights[m_num_vertices] = weight;
+    }
+    return static_cast<uint32_t>(m_num_vertices++);
+  }
+
+  void addIndex(const uint32_t vertex) { m_indices[m_num_indices++] = vertex; }
+
+  void endLayer() {}
+
+  size_t numVertices() const { return m_num_vertices; }
+  size_t numIndices() const { return m_num_indices; }
+
+ private:
+  SCALAR_POLYGONIZATION::Vec3<T>* m_positions;
+  uint32_t* m_indices;
+  uint64_t* m_edges;
+  T* m_weights;
+  size_t m_num_vertices;
+  size_t m_num_indices;
+};
+
+/*! Output of `polygonizeSlab` handing each layer of cubes to a sink.
+ *
+ * Only used with a single slab starting at layer 0. Vertices are numbered with 64 bits, but the edge index cache of
+ * the slab holds 32 bit indices: those are relative to the first vertex of the layer that created the vertex, with
+ * the parity of that layer in the top bit. Triangles only use vertices of the current and previous layers, so the
+ * parity tells which layer an index is relative to.
+ */
+template <typename T>
+class StreamOutput
+{
+ public:
+  explicit StreamOutput(const SCALAR_POLYGONIZATION::MeshSink<T>& sink)
+      : m_sink(sink), m_parity(0), m_layer_begin(0), m_previous_begin(0)
+  {
+  }
+
+  uint32_t addVertex(const SCALAR_POLYGONIZATION::Vec3<T>& position, const uint64_t, const T)
+  {
+    // Largest layer local index stays below `EdgeIndexCache::INVALID`.
+    if (m_positions.size() >= LAYER_BIT - 1) throw std::overflow_error("too many vertices in a layer of cubes");
+    m_positions.push_back(position);
+    return m_parity | static_cast<uint32_t>(m_positions.size() - 1);
+  }
+
+  void addIndex(const uint32_t vertex)
+  {
+    const uint64_t begin = (vertex & LAYER_BIT) == m_parity ? m_layer_begin : m_previous_begin;
+    m_indices.push_back(begin + (vertex & ~LAYER_BIT));
+  }
+
+  void endLayer()
+  {
+    m_previous_begin = m_layer_begin;
+    m_layer_begin += m_positions.size();
+    m_parity ^= LAYER_BIT;
+
+    if (m_positions.empty() && m_indices.empty()) return;
+
+    m_sink(m_positions, m_indices);
+    m_positions.clear();
+    m_indices.clear();
+  }
+
+ private:
+  static constexpr uint32_t LAYER_BIT = 0x80000000u;  //!< Parity of the layer creating a vertex.
+
+  const SCALAR_POLYGONIZATION::MeshSink<T>& m_sink;
+  uint32_t m_parity;                                        //!< Parity bit of the current layer.
+  uint64_t m_layer_begin;                                   //!< Index of the first vertex of the current layer.
+  uint64_t m_previous_begin;                                //!< Index of the first vertex of the previous layer.
+  std::vector<SCALAR_POLYGONIZATION::Vec3<T>> m_positions;  //!< Vertices of the current layer.
+  std::vector<uint64_t> m_indices;                          //!< Triangles of the current layer.
+};
+
+template <typename T>
+constexpr uint32_t StreamOutput<T>::LAYER_BIT;
+
+/*! Mark nodes `begin <= i < end` of a row as inside.
+ */
+inline void setNodeRange(const int begin, const int end, uint64_t* bits)
+{
+  for (int i = begin; i < end;) {
+    const int count = std::min(end - i, 64 - (i & 63));
+    bits[i >> 6] |= (count == 64 ? ~static_cast<uint64_t>(0) : (static_cast<uint64_t>(1) << count) - 1) << (i & 63);
+    i += count;
+  }
+}
+
+/*! Node planes of a volume held in memory, all of them are available.
+ *
+ * Node values are read by a slab through `load(k)`, called before the nodes of plane k are first read, and
+ * `row(j, k)`. Only planes k and k + 1 are read after `load(k + 1)`.
+ */
+template <typename T, typename S>
+class VolumePlanes
+{
+ public:
+  using value_type = S;
+
+  explicit VolumePlanes(const SCALAR_POLYGONIZATION::ScalarVolume<T, S>& volume) : m_volume(volume) {}
+
+  void load(const int) {}
+
+  //! Node 0 of row `j` of node plane `k`.
+  const S* row(const int j, const int k) const { return m_volume.data() + m_volume.offset(0, j, k); }
+
+  //! Distance between two consecutive nodes of a row.
+  size_t stride() const { return m_volume.stride(0); }
+
+ private:
+  const SCALAR_POLYGONIZATION::ScalarVolume<T, S>& m_volume;
+};
+
+/*! Two node planes at a time, sampled by a callback when loaded.
+ */
+template <typename T>
+class SampledPlanes
+{
+ public:
+  using value_type = T;
+
+  SampledPlanes(const int nx, const int ny, const SCALAR_POLYGONIZATION::PlaneSampler<T>& sample_plane)
+      : m_nx(nx), m_plane_size(static_cast<size_t>(nx) * ny), m_sample_plane(sample_plane), m_values(2 * m_plane_size)
+  {
+  }
+
+  void load(const int k) { m_sample_plane(k, &m_values[(k & 1) * m_plane_size]); }
+
+  const T* row(const int j, const int k) const
+  {
+    return &m_values[(k & 1) * m_plane_size + static_cast<size_t>(j) * m_nx];
+  }
+
+  size_t stride() const { return 1; }
+
+ private:
+  const int m_nx;
+  const size_t m_plane_size;
+  const SCALAR_POLYGONIZATION::PlaneSampler<T>& m_sample_plane;
+  std::vector<T> m_values;  //!< Node planes with even k, then with odd k.
+};
+
+/*! Inside/outside bits of the nodes of a slab, two node planes at a time.
+ *
+ * With brick ranges, only nodes of bricks intersected by the surface are read, nodes of other bricks take the side
+ * of their brick. Node i belongs to brick `min(i / BRICK_SIZE, last brick)` for this purpose. Nodes are compared in
+ * their storage type S against the iso-value mapped to it.
+ */
+template <typename T, typename Planes>
+class PlaneClassifier
+{
+ public:
+  using S = typename Planes::value_type;
+
+  PlaneClassifier(const int nx, const int ny, const Planes& planes,
+                  const SCALAR_POLYGONIZATION::BrickMinMax<T>* bricks, const T iso_alpha)
+      : m_nx(nx),
+        m_ny(ny),
+        m_planes(planes),
+        m_bricks(bricks),
+        m_iso_alpha(iso_alpha),
+        m_threshold(),
+        m_all_inside(!SCALAR_POLYGONIZATION::classificationThreshold(iso_alpha, m_threshold)),
+        m_words(SCALAR_POLYGONIZATION::classificationWords(nx)),
+        m_top_k(0),
+        m_bits{std::vector<uint64_t>(m_words * ny), std::vector<uint64_t>(m_words * ny)}
+  {
+  }
+
+  //! Classify node plane `k_begin` as the bottom plane.
+  void begin(const int k_begin)
+  {
+    for (int j = 0; j < m_ny; ++j) this->classifyRow(k_begin, j, &m_bits[0][m_words * j]);
+  }
+
+  //! Move to layer `k`: previous top plane becomes the bottom plane, rows of node plane `k + 1` are then classified
+  //! one at a time with `classifyTopRow`.
+  void next(const int k, const bool first)
+  {
+    if (!first) std::swap(m_bits[0], m_bits[1]);
+    m_top_k = k + 1;
+  }
+
+  //! Classify row `j` of the top plane.
+  void classifyTopRow(const int j) { this->classifyRow(m_top_k, j, &m_bits[1][m_words * j]); }
+
+  //! Bitmask of row `j` of the bottom (0) or top (1) node plane.
+  const uint64_t* row(const int plane, const int j) const { return &m_bits[plane][m_words * j]; }
+
+ private:
+  void classifyRow(const int k, const int j, uint64_t* row_bits)
+  {
+    using namespace SCALAR_POLYGONIZATION;
+
+    const int nx = m_nx;
+    const S* row = m_planes.row(j, k);
+
+    if (m_all_inside) {
+      memset(row_bits, 0, m_words * sizeof(uint64_t));
+      setNodeRange(0, nx, row_bits);
+      return;
+    }
+
+    if (!m_bricks) {
+      classifyNodes(row, m_planes.stride(), nx, m_threshold, row_bits);
+      return;
+    }
+
+    const int brick_size = BrickMinMax<T>::BRICK_SIZE;
+    const int nbx = m_bricks->numBricks(0);
+    const int bj = std::min(j / brick_size, m_bricks->numBricks(1) - 1);
+    const int bk = std::min(k / brick_size, m_bricks->numBricks(2) - 1);
+
+    memset(row_bits, 0, m_words * sizeof(uint64_t));
+    for (int bi = 0; bi < nbx; ++bi) {
+      const int begin = bi * brick_size, end = bi + 1 < nbx ? begin + brick_size : nx;
+      if (m_bricks->intersects(bi, bj, bk, m_iso_alpha))
+        classifyNodeRange(row, m_planes.stride(), begin, end, m_threshold, row_bits);
+      else if (m_bricks->max(bi, bj, bk) < m_iso_alpha)
+        setNodeRange(begin, end, row_bits);
+    }
+  }
+
+  const int m_nx, m_ny;
+  const Planes& m_planes;
+  const SCALAR_POLYGONIZATION::BrickMinMax<T>* m_bricks;
+  const T m_iso_alpha;
+  S m_threshold;
+  const bool m_all_inside;  //!< Every value of S is below the iso-value, `m_threshold` is unset.
+  const size_t m_words;
+  int m_top_k;
+  std::vector<uint64_t> m_bits[2];
+};
+
+/*! Count vertices and triangles `polygonizeSlab` creates, from node classification only.
+ *
+ * Every intersected grid edge gets one vertex, created by the slab owning it: edges along z of its layers and edges
+ * of its node planes but the bottom one, which belongs to the slab below (the first slab owns its bottom plane).
+ *
+ * \param slabs same slab for each iso-value.
+ */
+template <typename T, typename S, typename Planes>
+void countSlab(const SCALAR_POLYGONIZATION::ScalarVolume<T, S>& volume, Planes& nodes,
+               const SCALAR_POLYGONIZATION::BrickMinMax<T>* bricks, const std::vector<T>& iso_alphas,
+               const std::vector<Slab<T>*>& slabs)
+{
+  using namespace SCALAR_POLYGONIZATION;
+
+  const int nx = volume.dim(0), ny = volume.dim(1);
+  const int k_begin = slabs[0]->k_begin, k_end = slabs[0]->k_end;
+
+  std::vector<PlaneClassifier<T, Planes>> planes;
+  planes.reserve(iso_alphas.size());
+  for (const T iso_alpha : iso_alphas) planes.emplace_back(nx, ny, nodes, bricks, iso_alpha);
+
+  std::vector<int> cubes(nx);
+  std::vector<uint8_t> cases(nx);
+  std::vector<size_t> num_vertices(iso_alphas.size(), 0), num_triangles(iso_alphas.size(), 0);
+
+  nodes.load(k_begin);
+  for (auto& iso_planes : planes) iso_planes.begin(k_begin);
+
+  for (int k = k_begin; k < k_end; ++k) {
+    nodes.load(k + 1);
+    for (auto& iso_planes : planes) iso_planes.next(k, k == k_begin);
+
+    for (int j = 0; j < ny; ++j)
+      for (size_t m = 0; m < planes.size(); ++m) {
+        auto& iso_planes = planes[m];
+        iso_planes.classifyTopRow(j);
+
+        // Plane edges of row j and between rows j - 1 and j.
+        for (int plane = k == 0 ? 0 : 1; plane < 2; ++plane) {
+          num_vertices[m] += crossedEdgesAlongRow(iso_planes.row(plane, j), nx);
+          if (j > 0)
+            num_vertices[m] += crossedEdgesBetweenRows(iso_planes.row(plane, j - 1), iso_planes.row(plane, j), nx);
+        }
+        num_vertices[m] += crossedEdgesBetweenRows(iso_planes.row(0, j), iso_planes.row(1, j), nx);
+
+        if (j == 0) continue;
+        const int num_active = activeCubes(iso_planes.row(0, j - 1), iso_planes.row(0, j), iso_planes.row(1, j - 1),
+                                           iso_planes.row(1, j), nx - 1, cubes.data(), cases.data());
+        for (int a = 0; a < num_active; ++a) num_triangles[m] += triangle_count_table[cases[a]];
+      }
+  }
+
+  for (size_t m = 0; m < slabs.size(); ++m) {
+    slabs[m]->num_vertices = num_vertices[m];
+    slabs[m]->num_indices = 3 * num_triangles[m];
+  }
+}
+
+/*! Marching state of one iso-surface in a slab.
+ */
+template <typename T, typename Planes>
+struct IsoSurface {
+  IsoSurface(const int nx, const int ny, const Planes& nodes, const SCALAR_POLYGONIZATION::BrickMinMax<T>* bricks,
+             const T iso_alpha)
+      : iso_alpha(iso_alpha), planes(nx, ny, nodes, bricks, iso_alpha), edge_to_vertex(nx, ny)
+  {
+  }
+
+  T iso_alpha;                                           //!< Iso-value.
+  PlaneClassifier<T, Planes> planes;                     //!< Classification of nodes of the current layer.
+  SCALAR_POLYGONIZATION::EdgeIndexCache edge_to_vertex;  //!< Vertices on edges of the current layer.
+};
+
+/*! Marching cubes over the layers of a slab, for several iso-values at once.
+ *
+ * Node rows are classified and cube rows marched for all iso-values in turn, so that each part of the volume is
+ * read from memory once and then served from cache for the other iso-values.
+ *
+ * Vertices on the bottom node plane of a slab (except the first one) are created by the slab below, which also
+ * visits them as its top plane. They are referenced here with `SEAM` coded indices and resolved while stitching.
+ *
+ * \param slabs same slab for each iso-value.
+ * \param outputs output for each iso-value.
+ */
+template <typename T, typename S, typename Planes, typename Output>
+void polygonizeSlab(const SCALAR_POLYGONIZATION::ScalarVolume<T, S>& volume, Planes& nodes,
+                    const SCALAR_POLYGONIZATION::BrickMinMax<T>* bricks, const std::vector<T>& iso_alphas,
+                    const std::vector<Slab<T>*>& slabs, std::vector<Output>& outputs)
+{
+  using namespace SCALAR_POLYGONIZATION;
+
+  const int nx = volume.dim(0), ny = volume.dim(1);
+  const int k_begin = slabs[0]->k_begin, k_end = slabs[0]->k_end;
+
+  MarchingCubes<T> mc;
+  CubeTriangulation<T> triangulation;
+
+  // Marching cubes runs on a unit cube, vertex positions are then in node units relative to the cube. Cube vertex
+  // `v` of cube i is node `i + vertex_di[v]` of node row `vertex_row[v]` among (j, k), (j + 1, k), (j, k + 1) and
+  // (j + 1, k + 1).
+  std::array<Vec3<T>, 8> unit_cube;
+  std::array<int, 8> vertex_row;
+  std::array<size_t, 8> vertex_di;
+  for (int v = 0; v < 8; ++v) {
+    unit_cube[v] = Vec3<T>(vertex_offset[v][0], vertex_offset[v][1], vertex_offset[v][2]);
+    vertex_row[v] = static_cast<int>(vertex_offset[v][1]) + 2 * static_cast<int>(vertex_offset[v][2]);
+    vertex_di[v] = static_cast<size_t>(vertex_offset[v][0]) * nodes.stride();
+  }
+  const size_t stride = nodes.stride();
+
+  // Grid edge of each cube edge, relative to the grid edge of node (0, 0, 0) of the cube along x, and whether the
+  // weight of `marchCube`, measured from the first vertex of the edge, starts at its upper node.
+  std::array<uint64_t, 12> edge_offset;
+  std::array<bool, 12> edge_reversed;
+  for (int edge = 0; edge < 12; ++edge) {
+    const int v0 = Convention1::edgeVertex(edge, 0), v1 = Convention1::edgeVertex(edge, 1);
+    int axis = 0, node[3];
+    for (int d = 0; d < 3; ++d) {
+      const int o0 = Convention1::vertexOffset(v0, d), o1 = Convention1::vertexOffset(v1, d);
+      node[d] = std::min(o0, o1);
+      if (o0 != o1) axis = d;
+    }
+    edge_offset[edge] =
+        axis + 3 * (node[0] + static_cast<uint64_t>(nx) * (node[1] + static_cast<uint64_t>(ny) * node[2]));
+    edge_reversed[edge] = Convention1::vertexOffset(v0, axis) > Convention1::vertexOffset(v1, axis);
+  }
+
+  std::array<T, 8> scalars;
+
+  std::vector<IsoSurface<T, Planes>> surfaces;
+  surfaces.reserve(iso_alphas.size());
+  for (const T iso_alpha : iso_alphas) surfaces.emplace_back(nx, ny, nodes, bricks, iso_alpha);
+
+  if (k_begin > 0)
+    for (auto& surface : surfaces)
+      for (int j = 0; j < ny; ++j)
+        for (int i = 0; i < nx; ++i)
+          for (int axis = 0; axis < 2; ++axis)
+            surface.edge_to_vertex.edge(axis, i, j, false) = SEAM | static_cast<uint32_t>(axis + 3 * (i + nx * j));
+
+  std::vector<int> cubes(nx);
+  std::vector<uint8_t> cases(nx);
+
+  nodes.load(k_begin);
+  for (auto& surface : surfaces) surface.planes.begin(k_begin);
+
+  for (int k = k_begin; k < k_end; ++k) {
+    nodes.load(k + 1);
+    for (auto& surface : surfaces) {
+      if (k > k_begin) surface.edge_to_vertex.advance();
+      surface.planes.next(k, k == k_begin);
+    }
+
+    // Cube row j - 1 needs node row j of the top plane.
+    for (int j = 0; j < ny; ++j) {
+      const typename Planes::value_type* rows[4] = {nullptr, nullptr, nullptr, nullptr};
+      if (j > 0) {
+        rows[0] = nodes.row(j - 1, k);
+        rows[1] = nodes.row(j, k);
+        rows[2] = nodes.row(j - 1, k + 1);
+        rows[3] = nodes.row(j, k + 1);
+      }
+
+      for (size_t m = 0; m < surfaces.size(); ++m) {
+        auto& surface = surfaces[m];
+        auto& output = outputs[m];
+        const auto& planes = surface.planes;
+
+        surface.planes.classifyTopRow(j);
+        if (j == 0) continue;
+
+        const int num_active = activeCubes(planes.row(0, j - 1), planes.row(0, j), planes.row(1, j - 1),
+                                           planes.row(1, j), nx - 1, cubes.data(), cases.data());
+
+        for (int a = 0; a < num_active; ++a) {
+          const int i = cubes[a];
+          const size_t node = i * stride;
+          for (int v = 0; v < 8; ++v) scalars[v] = static_cast<T>(rows[vertex_row[v]][node + vertex_di[v]]);
+
+          mc.marchCube(unit_cube.data(), scalars.data(), nullptr, surface.iso_alpha, triangulation);
+
+          // Create a vertex only for edges not visited by a neighbouring cube.
+          uint32_t slot_to_vertex[CubeTriangulation<T>::MAX_VERTICES];
+          for (int slot = 0; slot < triangulation.num_vertices; ++slot) {
+            auto& vertex = surface.edge_to_vertex(triangulation.edges[slot], i, j - 1);
+            if (vertex == EdgeIndexCache::INVALID) {
+              const int edge = triangulation.edges[slot];
+              const auto& p = triangulation.positions[slot];
+              const T weight = triangulation.weights[slot];
+              vertex = output.addVertex(
+                  volume.position(i + p[0], j - 1 + p[1], k + p[2]),
+                  3 * (i + static_cast<uint64_t>(nx) * (j - 1 + static_cast<uint64_t>(ny) * k)) + edge_offset[edge],
+                  edge_reversed[edge] ? 1 - weight : weight);
+            }
+            slot_to_vertex[slot] = vertex;
+          }
+
+          for (int c = 0; c < 3 * triangulation.num_triangles; ++c)
+            output.addIndex(slot_to_vertex[triangulation.triangles[c]]);
+        }
+      }
+    }
+
+    for (auto& output : outputs) output.endLayer();
+  }
+
+  // Keep indices on the top plane for the slab above.
+  for (size_t m = 0; m < surfaces.size(); ++m) {
+    auto& top_plane = slabs[m]->top_plane;
+    top_plane.resize(3 * static_cast<size_t>(nx) * ny);
+    for (int j = 0; j < ny; ++j)
+      for (int i = 0; i < nx; ++i)
+        for (int axis = 0; axis < 2; ++axis)
+          top_plane[axis + 3 * (i + static_cast<size_t>(nx) * j)] = surfaces[m].edge_to_vertex.edge(axis, i, j, true);
+  }
+}
+
+/*! Global index of a slab local vertex index, given index of the first vertex of each slab.
+ */
+template <typename T>
+uint32_t stitchIndex(const std::vector<Slab<T>>& slabs, const std::vector<size_t>& vertex_begin, const size_t s,
+                     const uint32_t vertex)
+{
+  return static_cast<uint32_t>(s > 0 && vertex & SEAM ? vertex_begin[s - 1] + slabs[s - 1].top_plane[vertex & ~SEAM]
+                                                     : vertex_begin[s] + vertex);
+}
+
+/*! Slab `s` of each iso-value.
+ */
+template <typename T>
+std::vector<Slab<T>*> isoSlabs(std::vector<std::vector<Slab<T>>>& slabs, const size_t s)
+{
+  std::vector<Slab<T>*> iso_slabs;
+  for (auto& slabs_of_iso : slabs) iso_slabs.push_back(&slabs_of_iso[s]);
+  return iso_slabs;
+}
+
+/*! Concatenate slabs of one iso-value into a mesh.
+ */
+template <typename T>
+void concatenateSlabs(std::vector<Slab<T>>& slabs, const unsigned num_threads, const bool vertex_edges,
+                      SCALAR_POLYGONIZATION::IndexedMesh<T>& mesh)
+{
+  using namespace SCALAR_POLYGONIZATION;
+
+  if (slabs.size() == 1) {
+    mesh.positions = std::move(slabs[0].positions);
+    mesh.edges = std::move(slabs[0].edges);
+    mesh.weights = std::move(slabs[0].weights);
+    mesh.indices = std::move(slabs[0].indices);
+    return;
+  }
+
+  // Stitch: slabs are concatenated in order, seam vertices resolve to the slab below.
+  std::vector<size_t> vertex_begin(slabs.size() + 1, 0), index_begin(slabs.size() + 1, 0);
+  for (size_t s = 0; s < slabs.size(); ++s) {
+    vertex_begin[s + 1] = vertex_begin[s] + slabs[s].positions.size();
+    index_begin[s + 1] = index_begin[s] + slabs[s].indices.size();
+  }
+  checkNumVertices(vertex_begin.back());
+
+  mesh.positions.resize(vertex_begin.back());
+  mesh.indices.resize(index_begin.back());
+  if (vertex_edges) {
+    mesh.edges.resize(vertex_begin.back());
+    mesh.weights.resize(vertex_begin.back());
+  }
+
+  parallelFor(slabs.size(), num_threads, [&](const size_t s) {
+    std::copy(slabs[s].positions.begin(), slabs[s].positions.end(), mesh.positions.begin() + vertex_begin[s]);
+    if (vertex_edges) {
+      std::copy(slabs[s].edges.begin(), slabs[s].edges.end(), mesh.edges.begin() + vertex_begin[s]);
+      std::copy(slabs[s].weights.begin(), slabs[s].weights.end(), mesh.weights.begin() + vertex_begin[s]);
+    }
+
+    for (size_t c = 0; c < slabs[s].indices.size(); ++c)
+      mesh.indices[index_begin[s] + c] = stitchIndex(slabs, vertex_begin, s, slabs[s].indices[c]);
+
+    std::vector<Vec3<T>>().swap(slabs[s].positions);
+    std::vector<uint64_t>().swap(slabs[s].edges);
+    std::vector<T>().swap(slabs[s].weights);
+    std::vector<uint32_t>().swap(slabs[s].indices);
+  });
+}
+
+/*! Polygonize slabs into their own vectors, then concatenate them into the meshes.
+ *
+ * \param make_planes callable returning the node planes read by one slab.
+ * \param slabs slabs of each iso-value.
+ */
+template <typename T, typename S, typename MakePlanes>
+void polygonizeSinglePass(const SCALAR_POLYGONIZATION::ScalarVolume<T, S>& volume, const MakePlanes& make_planes,
+                          const SCALAR_POLYGONIZATION::BrickMinMax<T>* bricks, const std::vector<T>& iso_alphas,
+                          const unsigned num_threads, const bool vertex_edges,
+                          std::vector<std::vector<Slab<T>>>& slabs,
+                          std::vector<SCALAR_POLYGONIZATION::IndexedMesh<T>>& meshes)
+{
+  using namespace SCALAR_POLYGONIZATION;
+
+  parallelFor(slabs[0].size(), num_threads, [&](const size_t s) {
+    const auto iso_slabs = isoSlabs(slabs, s);
+    std::vector<GrowingOutput<T>> outputs;
+    for (auto* slab : iso_slabs) outputs.emplace_back(*slab, vertex_edges);
+    auto nodes = make_planes();
+    polygonizeSlab(volume, nodes, bricks, iso_alphas, iso_slabs, outputs);
+  });
+
+  for (size_t m = 0; m < iso_alphas.size(); ++m) concatenateSlabs(slabs[m], num_threads, vertex_edges, meshes[m]);
+}
+
+/*! Count vertices and triangles of slabs, allocate the meshes once and polygonize slabs in place.
+ *
+ * \param make_planes callable returning the node planes read by one slab.
+ * \param slabs slabs of each iso-value.
+ */
+template <typename T, typename S, typename MakePlanes>
+void polygonizeCountThenFill(const SCALAR_POLYGONIZATION::ScalarVolume<T, S>& volume, const MakePlanes& make_planes,
+                             const SCALAR_POLYGONIZATION::BrickMinMax<T>* bricks, const std::vector<T>& iso_alphas,
+                             const unsigned num_threads, const bool vertex_edges,
+                             std::vector<std::vector<Slab<T>>>& slabs,
+                             std::vector<SCALAR_POLYGONIZATION::IndexedMesh<T>>& meshes)
+{
+  using namespace SCALAR_POLYGONIZATION;
+
+  const size_t num_slabs = slabs[0].size();
+
+  parallelFor(num_slabs, num_threads, [&](const size_t s) {
+    auto nodes = make_planes();
+    countSlab(volume, nodes, bricks, iso_alphas, isoSlabs(slabs, s));
+  });
+
+  std::vector<std::vector<size_t>> vertex_begin(iso_alphas.size()), index_begin(iso_alphas.size());
+  for (size_t m = 0; m < iso_alphas.size(); ++m) {
+    vertex_begin[m].assign(num_slabs + 1, 0);
+    index_begin[m].assign(num_slabs + 1, 0);
+    for (size_t s = 0; s < num_slabs; ++s) {
+      if (slabs[m][s].num_vertices > maxSlabVertices(slabs[m][s]))
+        throw std::overflow_error("too many vertices in a slab");
+      vertex_begin[m][s + 1] = vertex_begin[m][s] + slabs[m][s].num_vertices;
+      index_begin[m][s + 1] = index_begin[m][s] + slabs[m][s].num_indices;
+    }
+    checkNumVertices(vertex_begin[m].back());
+
+    meshes[m].positions.resize(vertex_begin[m].back());
+    meshes[m].indices.resize(index_begin[m].back());
+    if (vertex_edges) {
+      meshes[m].edges.resize(vertex_begin[m].back());
+      meshes[m].weights.resize(vertex_begin[m].back());
+    }
+  }
+
+  // Each slab writes its own ranges, vertex indices are slab local until all top planes are known.
+  parallelFor(num_slabs, num_threads, [&](const size_t s) {
+    std::vector<FixedOutput<T>> outputs;
+    for (size_t m = 0; m < iso_alphas.size(); ++m)
+      outputs.emplace_back(meshes[m].positions.data() + vertex_begin[m][s],
+                           meshes[m].indices.data() + index_begin[m][s],
+                           vertex_edges ? meshes[m].edges.data() + vertex_begin[m][s] : nullptr,
+                           vertex_edges ? meshes[m].weights.data() + vertex_begin[m][s] : nullptr);
+
+    auto nodes = make_planes();
+    polygonizeSlab(volume, nodes, bricks, iso_alphas, isoSlabs(slabs, s), outputs);
+
+    for (size_t m = 0; m < iso_alphas.size(); ++m)
+      assert(outputs[m].numVertices() == slabs[m][s].num_vertices &&
+             outputs[m].numIndices() == slabs[m][s].num_indices);
+  });
+
+  if (num_slabs == 1) return;
+
+  parallelFor(iso_alphas.size() * num_slabs, num_threads, [&](const size_t task) {
+    const size_t m = task / num_slabs, s = task % num_slabs;
+    for (size_t c = index_begin[m][s]; c < index_begin[m][s + 1]; ++c)
+      meshes[m].indices[c] = stitchIndex(slabs[m], vertex_begin[m], s, meshes[m].indices[c]);
+  });
+}
+
+/*! Polygonize a scalar volume for several iso-values, skipping bricks away from the surfaces if `bricks` is given.
+ *
+ * \param volume grid of the volume, its nodes are only read through the planes returned by `make_planes`.
+ * \param make_planes callable returning the node planes read by one slab.
+ */
+template <typename T, typename S, typename MakePlanes>
+std::vector<SCALAR_POLYGONIZATION::IndexedMesh<T>> polygonize(const SCALAR_POLYGONIZATION::ScalarVolume<T, S>& volume,
+                                                              const MakePlanes& make_planes,
+                                                              const SCALAR_POLYGONIZATION::BrickMinMax<T>* bricks,
+                                                              const std::vector<T>& iso_alphas,
+                                                              const SCALAR_POLYGONIZATION::PolygonizeOptions& options)
+{
+  using namespace SCALAR_POLYGONIZATION;
+
+  std::vector<IndexedMesh<T>> meshes(iso_alphas.size());
+
+  const int nx = volume.dim(0), ny = volume.dim(1), nz = volume.dim(2);
+  if (nx < 2 || ny < 2 || nz < 2 || iso_alphas.empty()) return meshes;
+
+  // A few slabs per thread to balance slabs with different amount of surface.
+  const unsigned num_threads = numThreads(options.num_threads);
+  const int num_layers = nz - 1;
+  const int num_slabs = static_cast<int>(numSlabs(num_layers, num_threads));
+
+  // Edges of a node plane are `SEAM` coded in slabs above the first one.
+  if (num_slabs > 1 && 3 * static_cast<size_t>(nx) * ny > SEAM)
+    throw std::overflow_error("node planes too large for several slabs");
+
+  std::vector<std::vector<Slab<T>>> slabs(iso_alphas.size(), std::vector<Slab<T>>(num_slabs));
+  for (auto& slabs_of_iso : slabs)
+    for (int s = 0; s < num_slabs; ++s) {
+      slabs_of_iso[s].k_begin = static_cast<int>(slabBegin(num_layers, num_slabs, s));
+      slabs_of_iso[s].k_end = static_cast<int>(slabBegin(num_layers, num_slabs, s + 1));
+      slabs_of_iso[s].num_vertices = slabs_of_iso[s].num_indices = 0;
+    }
+
+  if (options.extraction == PolygonizeOptions::Extraction::COUNT_THEN_FILL)
+    polygonizeCountThenFill(volume, make_planes, bricks, iso_alphas, num_threads, options.vertex_edges, slabs,
+                            meshes);
+  else
+    polygonizeSinglePass(volume, make_planes, bricks, iso_alphas, num_threads, options.vertex_edges, slabs, meshes);
+
+  for (auto& mesh : meshes) computeVertexNormals(mesh, options.normal_weighting, num_threads);
+
+  return meshes;
+}
+
+/*! Callable returning the planes of a volume held in memory, for `polygonize`.
+ */
+template <typename T, typename S>
+std::function<VolumePlanes<T, S>()> volumePlanes(const SCALAR_POLYGONIZATION::ScalarVolume<T, S>& volume)
+{
+  return [&volume]() { return VolumePlanes<T, S>(volume); };
+}
+}  // namespace
+
+template <typename T, typename S>
+SCALAR_POLYGONIZATION::IndexedMesh<T> SCALAR_POLYGONIZATION::polygonizeVolume(const ScalarVolume<T, S>& volume,
+                                                                              const T iso_alpha,
+                                                                              const PolygonizeOptions& options)
+{
+  return std::move(polygonize(volume, volumePlanes(volume), static_cast<const BrickMinMax<T>*>(nullptr), {iso_alpha},
+                              options)[0]);
+}
+
+template <typename T, typename S>
+std::vector<SCALAR_POLYGONIZATION::IndexedMesh<T>> SCALAR_POLYGONIZATION::polygonizeVolume(
+    const ScalarVolume<T, S>& volume, const std::vector<T>& iso_alphas, const PolygonizeOptions& options)
+{
+  return polygonize(volume, volumePlanes(volume), static_cast<const BrickMinMax<T>*>(nullptr), iso_alphas, options);
+}
+
+template <typename T>
+SCALAR_POLYGONIZATION::IndexedMesh<T> SCALAR_POLYGONIZATION::polygonizeVolume(const ScalarVolume<T>& volume,
+                                                                              const BrickMinMax<T>& bricks,
+                                                                              const T iso_alpha,
+                                                                              const PolygonizeOptions& options)
+{
+  if (!(bricks.dims() == volume.dims())) throw std::invalid_argument("brick ranges of a volume of other dimensions");
+
+  return std::move(polygonize(volume, volumePlanes(volume), &bricks, {iso_alpha}, options)[0]);
+}
+
+template <typename T>
+SCALAR_POLYGONIZATION::IndexedMesh<T> SCALAR_POLYGONIZATION::polygonizePlanes(const PlaneSampler<T>& sample_plane,
+                                                                              const Vec3<int>& dims,
+                                                                              const Vec3<T>& origin,
+                                                                              const Vec3<T>& spacing,
+                                                                              const T iso_alpha,
+                                                                              const PolygonizeOptions& options)
+{
+  // Only the grid of the volume is used, nodes are read from the sampled planes.
+  const ScalarVolume<T> grid(static_cast<const T*>(nullptr), dims, origin, spacing);
+  const std::function<SampledPlanes<T>()> make_planes = [&]() {
+    return SampledPlanes<T>(dims[0], dims[1], sample_plane);
+  };
+
+  return std::move(polygonize(grid, make_planes, static_cast<const BrickMinMax<T>*>(nullptr), {iso_alpha}, options)[0]);
+}
+
+template <typename T>
+void SCALAR_POLYGONIZATION::polygonizeStream(const PlaneSampler<T>& read_plane, const Vec3<int>& dims,
+                                             const Vec3<T>& origin, const Vec3<T>& spacing, const T iso_alpha,
+                                             const MeshSink<T>& sink)
+{
+  if (dims[0] < 2 || dims[1] < 2 || dims[2] < 2) return;
+
+  const ScalarVolume<T> grid(static_cast<const T*>(nullptr), dims, origin, spacing);
+  SampledPlanes<T> planes(dims[0], dims[1], read_plane);
+
+  Slab<T> slab;
+  slab.k_begin = 0;
+  slab.k_end = dims[2] - 1;
+  std::vector<StreamOutput<T>> outputs(1, StreamOutput<T>(sink));
+
+  polygonizeSlab(grid, planes, static_cast<const BrickMinMax<T>*>(nullptr), {iso_alpha}, {&slab}, outputs);
+}
+
+template class SCALAR_POLYGONIZATION::ScalarVolume<float>;
+template class SCALAR_POLYGONIZATION::ScalarVolume<float, uint8_t>;
+template class SCALAR_POLYGONIZATION::ScalarVolume<float, uint16_t>;
+template class SCALAR_POLYGONIZATION::ScalarVolume<double>;
+template class SCALAR_POLYGONIZATION::IndexedMesh<float>;
+template class SCALAR_POLYGONIZATION::IndexedMesh<double>;
+template class SCALAR_POLYGONIZATION::IndexedMesh<float, uint64_t>;
+template class SCALAR_POLYGONIZATION::IndexedMesh<double, uint64_t>;
+template void SCALAR_POLYGONIZATION::computeVertexNormals<float, uint32_t>(IndexedMesh<float>&,
+                                                                           const NormalWeighting, const unsigned);
+template void SCALAR_POLYGONIZATION::computeVertexNormals<double, uint32_t>(IndexedMesh<double>&,
+                                                                            const NormalWeighting, const unsigned);
+template void SCALAR_POLYGONIZATION::computeVertexNormals<float, uint64_t>(IndexedMesh<float, uint64_t>&,
+                                                                           const NormalWeighting, const unsigned);
+template void SCALAR_POLYGONIZATION::computeVertexNormals<double, uint64_t>(IndexedMesh<double, uint64_t>&,
+                                                                            const NormalWeighting, const unsigned);
+template SCALAR_POLYGONIZATION::IndexedMesh<float> SCALAR_POLYGONIZATION::polygonizeVolume<float, float>(
+    const ScalarVolume<float>&, const float, const PolygonizeOptions&);
+template SCALAR_POLYGONIZATION::IndexedMesh<float> SCALAR_POLYGONIZATION::polygonizeVolume<float, uint8_t>(
+    const ScalarVolume<float, uint8_t>&, const float, const PolygonizeOptions&);
+template SCALAR_POLYGONIZATION::IndexedMesh<float> SCALAR_POLYGONIZATION::polygonizeVolume<float, uint16_t>(
+    const ScalarVolume<float, uint16_t>&, const float, const PolygonizeOptions&);
+template SCALAR_POLYGONIZATION::IndexedMesh<double> SCALAR_POLYGONIZATION::polygonizeVolume<double, double>(
+    const ScalarVolume<double>&, const double, const PolygonizeOptions&);
+template std::vector<SCALAR_POLYGONIZATION::IndexedMesh<float>> SCALAR_POLYGONIZATION::polygonizeVolume<float, float>(
+    const ScalarVolume<float>&, const std::vector<float>&, const PolygonizeOptions&);
+template std::vector<SCALAR_POLYGONIZATION::IndexedMesh<float>>
+SCALAR_POLYGONIZATION::polygonizeVolume<float, uint8_t>(const ScalarVolume<float, uint8_t>&, const std::vector<float>&,
+                                                        const PolygonizeOptions&);
+template std::vector<SCALAR_POLYGONIZATION::IndexedMesh<float>>
+SCALAR_POLYGONIZATION::polygonizeVolume<float, uint16_t>(const ScalarVolume<float, uint16_t>&,
+                                                         const std::vector<float>&, const PolygonizeOptions&);
+template std::vector<SCALAR_POLYGONIZATION::IndexedMesh<double>>
+SCALAR_POLYGONIZATION::polygonizeVolume<double, double>(const ScalarVolume<double>&, const std::vector<double>&,
+                                                        const PolygonizeOptions&);
+template SCALAR_POLYGONIZATION::IndexedMesh<float> SCALAR_POLYGONIZATION::polygonizeVolume<float>(
+    const ScalarVolume<float>&, const BrickMinMax<float>&, const float, const PolygonizeOptions&);
+template SCALAR_POLYGONIZATION::IndexedMesh<double> SCALAR_POLYGONIZATION::polygonizeVolume<double>(
+    const ScalarVolume<double>&, const BrickMinMax<double>&, const double, const PolygonizeOptions&);
+template SCALAR_POLYGONIZATION::IndexedMesh<float> SCALAR_POLYGONIZATION::polygonizePlanes<float>(
+    const PlaneSampler<float>&, const Vec3<int>&, const Vec3<float>&, const Vec3<float>&, const float,
+    const PolygonizeOptions&);
+template SCALAR_POLYGONIZATION::IndexedMesh<double> SCALAR_POLYGONIZATION::polygonizePlanes<double>(
+    const PlaneSampler<double>&, const Vec3<int>&, const Vec3<double>&, const Vec3<double>&, const double,
+    const PolygonizeOptions&);
+template void SCALAR_POLYGONIZATION::polygonizeStream<float>(const PlaneSampler<float>&, const Vec3<int>&,
+                                                             const Vec3<float>&, const Vec3<float>&, const float,
+                                                             const MeshSink<float>&);
+template void SCALAR_POLYGONIZATION::polygonizeStream<double>(const PlaneSampler<double>&, const Vec3<int>&,
+                                                              const Vec3<double>&, const Vec3<double>&, const double,
+                                                              const MeshSink<double>&);
+#if defined(SP_HAS_FLOAT16)
+template class SCALAR_POLYGONIZATION::ScalarVolume<float, _Float16>;
+template SCALAR_POLYGONIZATION::IndexedMesh<float> SCALAR_POLYGONIZATION::polygonizeVolume<float, _Float16>(
+    const ScalarVolume<float, _Float16>&, const float, const PolygonizeOptions&);
+template std::vector<SCALAR_POLYGONIZATION::IndexedMesh<float>>
+SCALAR_POLYGONIZATION::polygonizeVolume<float, _Float16>(const ScalarVolume<float, _Float16>&,
+                                                         const std::vector<float>&, const PolygonizeOptions&);
+#endif
@@ -0,0 +1,327 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright 2019 Lakshman Anumolu.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///////////////////////////////////////////////////////////////////////////////
+
+#include "scalar_polygonization/span_space_index.h"
+#include "scalar_polygonization/marching_cubes.h"
+#include "scalar_polygonization/parallel.h"
+#include "scalar_polygonization/tables.h"
+
+#include <algorithm>
+#include <array>
+#include <assert.h>
+#include <stdexcept>
+#include <utility>
+
+template <typename T>
+SCALAR_POLYGONIZATION::SpanSpaceIndex<T>::SpanSpaceIndex(const BrickMinMax<T>& bricks)
+{
+  for (int axis = 0; axis < 3; ++axis) {
+    m_dims[axis] = bricks.dims()[axis];
+    m_num_bricks[axis] = bricks.numBricks(axis);
+  }
+
+  std::vector<Interval> intervals;
+  for (int bk = 0; bk < m_num_bricks[2]; ++bk)
+    for (int bj = 0; bj < m_num_bricks[1]; ++bj)
+      for (int bi = 0; bi < m_num_bricks[0]; ++bi) {
+        const Interval interval = {bricks.min(bi, bj, bk), bricks.max(bi, bj, bk),
+                                   static_cast<uint32_t>(bi + m_num_bricks[0] * (bj + m_num_bricks[1] * bk))};
+        if (interval.min < interval.max) intervals.push_back(interval);
+      }
+
+  m_by_min.reserve(intervals.size());
+  m_by_max.reserve(intervals.size());
+  this->build(intervals);
+}
+
+template <typename T>
+int SCALAR_POLYGONIZATION::SpanSpaceIndex<T>::build(std::vector<Interval>& intervals)
+{
+  if (intervals.empty()) return -1;
+
+  // Median of maxima as center, the interval ending there stays in this node so that recursion always progresses.
+  std::vector<T> maxima(intervals.size());
+  for (size_t i = 0; i < intervals.size(); ++i) maxima[i] = intervals[i].max;
+  std::nth_element(maxima.begin(), maxima.begin() + maxima.size() / 2, maxima.end());
+  const T center = maxima[maxima.size() / 2];
+
+  std::vector<Interval> left, right;
+  Node node = {center, m_by_min.size(), m_by_min.size(), -1, -1};
+  for (const auto& interval : intervals) {
+    if (interval.max < center)
+      left.push_back(interval);
+    else if (!(interval.min < center))
+      right.push_back(interval);
+    else {
+      m_by_min.push_back(interval);
+      m_by_max.push_back(interval);
+    }
+  }
+  node.end = m_by_min.size();
+  std::vector<Interval>().swap(intervals);
+
+  std::sort(m_by_min.begin() + node.begin, m_by_min.end(),
+            [](const Interval& a, const Interval& b) { return a.min < b.min; });
+  std::sort(m_by_max.begin() + node.begin, m_by_max.end(),
+            [](const Interval& a, const Interval& b) { return b.max < a.max; });
+
+  const int n = static_cast<int>(m_nodes.size());
+  m_nodes.push_back(node);
+
+  const int left_child = this->build(left);
+  const int right_child = this->build(right);
+  m_nodes[n].left = left_child;
+  m_nodes[n].right = right_child;
+
+  return n;
+}
+
+template <typename T>
+void SCALAR_POLYGONIZATION::SpanSpaceIndex<T>::query(const T iso_alpha, std::vector<uint32_t>& bricks) const
+{
+  bricks.clear();
+
+  // Intervals of a node contain its center, so only one side of them needs checking, and only one child.
+  for (int n = m_nodes.empty() ? -1 : 0; n >= 0;) {
+    const Node& node = m_nodes[n];
+    if (!(node.center < iso_alpha)) {
+      for (size_t i = node.begin; i < node.end && m_by_min[i].min < iso_alpha; ++i) bricks.push_back(m_by_min[i].brick);
+      n = node.left;
+    } else {
+      for (size_t i = node.begin; i < node.end && !(m_by_max[i].max < iso_alpha); ++i)
+        bricks.push_back(m_by_max[i].brick);
+      n = node.right;
+    }
+  }
+
+  std::sort(bricks.begin(), bricks.end());
+}
+
+namespace
+{
+//! Marks a vertex index referring to an edge owned by another brick, remaining bits index `BrickMesh::externals`.
+const uint32_t EXTERNAL = 0x80000000u;
+
+//! Index of an edge without a vertex.
+const uint32_t INVALID = UINT32_MAX;
+
+//! Number of nodes along each side of a brick.
+const int BRICK_NODES = SCALAR_POLYGONIZATION::BrickMinMax<float>::BRICK_SIZE + 1;
+
+/*! Part of the mesh created by one brick.
+ */
+template <typename T>
+struct BrickMesh {
+  uint32_t brick;                                                //!< Brick number.
+  std::vector<SCALAR_POLYGONIZATION::Vec3<T>> positions;        //!< Vertices on edges owned by the brick.
+  std::vector<uint64_t> edges;                                   //!< Grid edge of each vertex, if requested.
+  std::vector<T> weights;                                        //!< Position of each vertex along its edge.
+  std::vector<uint32_t> indices;                                 //!< Brick local vertex indices, or `EXTERNAL` coded.
+  std::vector<std::pair<uint32_t, uint32_t>> externals;          //!< Owner brick and edge slot of external vertices.
+  std::vector<uint32_t> edge_to_vertex;                          //!< Local vertex index of each owned edge slot.
+};
+
+/*! Marching cubes over the cubes of a brick.
+ *
+ * Edge with first node n (along each axis) belongs to brick `min(n / BRICK_SIZE, last brick)`. The owner contains
+ * the edge, so it is among the bricks found whenever the edge is intersected. Its slot in the owner is
+ * `axis + 3 * (local node index)`, local node indices running over `BRICK_NODES`^3 nodes.
+ */
+template <typename T>
+void polygonizeBrick(const SCALAR_POLYGONIZATION::ScalarVolume<T>& volume, const int* num_bricks, const T iso_alpha,
+                     const bool vertex_edges, BrickMesh<T>& mesh)
+{
+  using namespace SCALAR_POLYGONIZATION;
+
+  const int brick_size = BrickMinMax<T>::BRICK_SIZE;
+  const int brick[3] = {static_cast<int>(mesh.brick % num_bricks[0]),
+                        static_cast<int>(mesh.brick / num_bricks[0] % num_bricks[1]),
+                        static_cast<int>(mesh.brick / num_bricks[0] / num_bricks[1])};
+
+  MarchingCubes<T> mc;
+  CubeTriangulation<T> triangulation;
+
+  std::array<Vec3<T>, 8> unit_cube;
+  std::array<size_t, 8> vertex_offsets;
+  for (int v = 0; v < 8; ++v) {
+    unit_cube[v] = Vec3<T>(vertex_offset[v][0], vertex_offset[v][1], vertex_offset[v][2]);
+    vertex_offsets[v] = static_cast<size_t>(vertex_offset[v][0]) * volume.stride(0) +
+                        static_cast<size_t>(vertex_offset[v][1]) * volume.stride(1) +
+                        static_cast<size_t>(vertex_offset[v][2]) * volume.stride(2);
+  }
+
+  // Axis and first node, relative to the cube, of each cube edge, and whether the weight of `marchCube` is measured
+  // from its upper node.
+  int edge_axis[12], edge_node[12][3];
+  bool edge_reversed[12];
+  for (int edge = 0; edge < 12; ++edge) {
+    const float* v0 = vertex_offset[edge_connection[edge][0]];
+    const float* v1 = vertex_offset[edge_connection[edge][1]];
+    for (int axis = 0; axis < 3; ++axis) {
+      if (v0[axis] != v1[axis]) edge_axis[edge] = axis;
+      edge_node[edge][axis] = static_cast<int>(std::min(v0[axis], v1[axis]));
+    }
+    edge_reversed[edge] = v0[edge_axis[edge]] > v1[edge_axis[edge]];
+  }
+
+  mesh.edge_to_vertex.assign(3 * BRICK_NODES * BRICK_NODES * BRICK_NODES, INVALID);
+
+  int cube_begin[3], cube_end[3];
+  for (int axis = 0; axis < 3; ++axis) {
+    cube_begin[axis] = brick[axis] * brick_size;
+    cube_end[axis] = std::min(cube_begin[axis] + brick_size, volume.dim(axis) - 1);
+  }
+
+  std::array<T, 8> scalars;
+
+  for (int k = cube_begin[2]; k < cube_end[2]; ++k)
+    for (int j = cube_begin[1]; j < cube_end[1]; ++j)
+      for (int i = cube_begin[0]; i < cube_end[0]; ++i) {
+        const T* cell = volume.data() + volume.offset(i, j, k);
+        for (int v = 0; v < 8; ++v) scalars[v] = cell[vertex_offsets[v]];
+
+        if (!mc.marchCube(unit_cube.data(), scalars.data(), nullptr, iso_alpha, triangulation)) continue;
+
+        uint32_t slot_to_vertex[CubeTriangulation<T>::MAX_VERTICES];
+        for (int slot = 0; slot < triangulation.num_vertices; ++slot) {
+          const int edge = triangulation.edges[slot];
+          const int node[3] = {i + edge_node[edge][0], j + edge_node[edge][1], k + edge_node[edge][2]};
+
+          int owner[3];
+          for (int axis = 0; axis < 3; ++axis) owner[axis] = std::min(node[axis] / brick_size, num_bricks[axis] - 1);
+          const uint32_t edge_slot = static_cast<uint32_t>(
+              edge_axis[edge] + 3 * ((node[0] - owner[0] * brick_size) +
+                                     BRICK_NODES * ((node[1] - owner[1] * brick_size) +
+                                                    BRICK_NODES * (node[2] - owner[2] * brick_size))));
+
+          if (owner[0] == brick[0] && owner[1] == brick[1] && owner[2] == brick[2]) {
+            auto& vertex = mesh.edge_to_vertex[edge_slot];
+            if (vertex == INVALID) {
+              const auto& p = triangulation.positions[slot];
+              vertex = static_cast<uint32_t>(mesh.positions.size());
+              mesh.positions.push_back(volume.position(i + p[0], j + p[1], k + p[2]));
+              if (vertex_edges) {
+                const T weight = triangulation.weights[slot];
+                mesh.edges.push_back(edge_axis[edge] +
+                                     3 * (node[0] + static_cast<uint64_t>(volume.dim(0)) *
+                                                        (node[1] + static_cast<uint64_t>(volume.dim(1)) * node[2])));
+                mesh.weights.push_back(edge_reversed[edge] ? 1 - weight : weight);
+              }
+            }
+            slot_to_vertex[slot] = vertex;
+          } else {
+            const uint32_t owner_brick =
+                static_cast<uint32_t>(owner[0] + num_bricks[0] * (owner[1] + num_bricks[1] * owner[2]));
+            slot_to_vertex[slot] = EXTERNAL | static_cast<uint32_t>(mesh.externals.size());
+            mesh.externals.push_back(std::make_pair(owner_brick, edge_slot));
+          }
+        }
+
+        for (int c = 0; c < 3 * triangulation.num_triangles; ++c)
+          mesh.indices.push_back(slot_to_vertex[triangulation.triangles[c]]);
+      }
+}
+}  // namespace
+
+template <typename T>
+SCALAR_POLYGONIZATION::IndexedMesh<T> SCALAR_POLYGONIZATION::polygonizeVolume(const ScalarVolume<T>& volume,
+                                                                              const SpanSpaceIndex<T>& index,
+                                                                              const T iso_alpha,
+                                                                              const PolygonizeOptions& options)
+{
+  if (!(index.dims() == volume.dims())) throw std::invalid_argument("span space index of a volume of other dimensions");
+
+  IndexedMesh<T> mesh;
+
+  std::vector<uint32_t> bricks;
+  index.query(iso_alpha, bricks);
+  if (bricks.empty()) return mesh;
+
+  const int num_bricks[3] = {index.numBricks(0), index.numBricks(1), index.numBricks(2)};
+  const unsigned num_threads = numThreads(options.num_threads);
+
+  std::vector<BrickMesh<T>> brick_meshes(bricks.size());
+  parallelFor(bricks.size(), num_threads, [&](const size_t b) {
+    brick_meshes[b].brick = bricks[b];
+    polygonizeBrick(volume, num_bricks, iso_alpha, options.vertex_edges, brick_meshes[b]);
+  });
+
+  // Stitch: bricks are concatenated in order, external vertices resolve to their owner brick.
+  std::vector<size_t> vertex_begin(bricks.size() + 1, 0), index_begin(bricks.size() + 1, 0);
+  for (size_t b = 0; b < bricks.size(); ++b) {
+    vertex_begin[b + 1] = vertex_begin[b] + brick_meshes[b].positions.size();
+    index_begin[b + 1] = index_begin[b] + brick_meshes[b].indices.size();
+  }
+  if (vertex_begin.back() > static_cast<uint64_t>(UINT32_MAX) + 1)
+    throw std::overflow_error("too many vertices for 32 bit indices");
+
+  mesh.positions.resize(vertex_begin.back());
+  mesh.indices.resize(index_begin.back());
+  if (options.vertex_edges) {
+    mesh.edges.resize(vertex_begin.back());
+    mesh.weights.resize(vertex_begin.back());
+  }
+
+  parallelFor(bricks.size(), num_threads, [&](const size_t b) {
+    const auto& brick_mesh = brick_meshes[b];
+    std::copy(brick_mesh.positions.begin(), brick_mesh.positions.end(), mesh.positions.begin() + vertex_begin[b]);
+    if (options.vertex_edges) {
+      std::copy(brick_mesh.edges.begin(), brick_mesh.edges.end(), mesh.edges.begin() + vertex_begin[b]);
+      std::copy(brick_mesh.weights.begin(), brick_mesh.weights.end(), mesh.weights.begin() + vertex_begin[b]);
+    }
+
+    for (size_t c = 0; c < brick_mesh.indices.size(); ++c) {
+      const uint32_t vertex = brick_mesh.indices[c];
+      if (vertex & EXTERNAL) {
+        const auto& external = brick_mesh.externals[vertex & ~EXTERNAL];
+        const size_t owner = std::lower_bound(bricks.begin(), bricks.end(), external.first) - bricks.begin();
+        assert(owner < bricks.size() && bricks[owner] == external.first);
+        assert(brick_meshes[owner].edge_to_vertex[external.second] != INVALID);
+        mesh.indices[index_begin[b] + c] =
+            static_cast<uint32_t>(vertex_begin[owner] + brick_meshes[owner].edge_to_vertex[external.second]);
+      } else
+        mesh.indices[index_begin[b] + c] = static_cast<uint32_t>(vertex_begin[b] + vertex);
+    }
+  });
+
+  std::vector<BrickMesh<T>>().swap(brick_meshes);
+
+  computeVertexNormals(mesh, options.normal_weighting, num_threads);
+
+  return mesh;
+}
+
+template class SCALAR_POLYGONIZATION::SpanSpaceIndex<float>;
+template SCALAR_POLYGONIZATION::IndexedMesh<float> SCALAR_POLYGONIZATION::polygonizeVolume<float>(
+    const ScalarVolume<float>&, const SpanSpaceIndex<float>&, const float, const PolygonizeOptions&);
+template class SCALAR_POLYGONIZATION::SpanSpaceIndex<double>;
+template SCALAR_POLYGONIZATION::IndexedMesh<double> SCALAR_POLYGONIZATION::polygonizeVolume<double>(
+    const ScalarVolume<double>&, const SpanSpaceIndex<double>&, const double, const PolygonizeOptions&);
@@ -0,0 +1,405 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright 2019 Lakshman Anumolu.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///////////////////////////////////////////////////////////////////////////////
+
+#include "scalar_polygonization/sparse_volume.h"
+#include "scalar_polygonization/conventions.h"
+#include "scalar_polygonization/marching_cubes.h"
+#include "scalar_polygonization/parallel.h"
+
+#include <assert.h>
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+
+template <typename T>
+constexpr int SCALAR_POLYGONIZATION::SparseVolume<T>::BRICK_SIZE;
+
+template <typename T>
+constexpr int SCALAR_POLYGONIZATION::SparseVolume<T>::BRICK_NODES;
+
+template <typename T>
+constexpr uint32_t SCALAR_POLYGONIZATION::SparseVolume<T>::TILE;
+
+template <typename T>
+SCALAR_POLYGONIZATION::SparseVolume<T>::SparseVolume(const Vec3<int>& dims, const Vec3<T>& origin,
+                                                     const Vec3<T>& spacing, const T background)
+{
+  for (int axis = 0; axis < 3; ++axis) {
+    m_dims[axis] = std::max(dims[axis], 0);
+    m_num_bricks[axis] = (m_dims[axis] + BRICK_SIZE - 1) / BRICK_SIZE;
+    m_origin[axis] = origin[axis];
+    m_spacing[axis] = spacing[axis];
+  }
+
+  const size_t num_bricks = static_cast<size_t>(m_num_bricks[0]) * m_num_bricks[1] * m_num_bricks[2];
+  m_table.assign(num_bricks, TILE);
+  m_tiles.assign(num_bricks, background);
+}
+
+template <typename T>
+T SCALAR_POLYGONIZATION::SparseVolume<T>::value(const int i, const int j, const int k) const
+{
+  assert(i >= 0 && j >= 0 && k >= 0 && i < m_dims[0] && j < m_dims[1] && k < m_dims[2]);
+
+  const size_t b = this->brickIndex(i / BRICK_SIZE, j / BRICK_SIZE, k / BRICK_SIZE);
+  if (m_table[b] == TILE) return m_tiles[b];
+
+  const int node = i % BRICK_SIZE + BRICK_SIZE * (j % BRICK_SIZE + BRICK_SIZE * (k % BRICK_SIZE));
+  return m_values[static_cast<size_t>(m_table[b]) * BRICK_NODES + node];
+}
+
+template <typename T>
+void SCALAR_POLYGONIZATION::SparseVolume<T>::setValue(const int i, const int j, const int k, const T value)
+{
+  assert(i >= 0 && j >= 0 && k >= 0 && i < m_dims[0] && j < m_dims[1] && k < m_dims[2]);
+
+  T* values = this->allocateBrick(i / BRICK_SIZE, j / BRICK_SIZE, k / BRICK_SIZE);
+  values[i % BRICK_SIZE + BRICK_SIZE * (j % BRICK_SIZE + BRICK_SIZE * (k % BRICK_SIZE))] = value;
+}
+
+template <typename T>
+const T* SCALAR_POLYGONIZATION::SparseVolume<T>::brick(const int bi, const int bj, const int bk) const
+{
+  const uint32_t number = m_table[this->brickIndex(bi, bj, bk)];
+  return number == TILE ? nullptr : &m_values[static_cast<size_t>(number) * BRICK_NODES];
+}
+
+template <typename T>
+T* SCALAR_POLYGONIZATION::SparseVolume<T>::allocateBrick(const int bi, const int bj, const int bk)
+{
+  const size_t b = this->brickIndex(bi, bj, bk);
+  if (m_table[b] == TILE) {
+    uint32_t number;
+    if (!m_free_bricks.empty()) {
+      number = m_free_bricks.back();
+      m_free_bricks.pop_back();
+    } else {
+      if (m_values.size() / BRICK_NODES >= TILE) throw std::runtime_error("too many bricks in sparse volume");
+      number = static_cast<uint32_t>(m_values.size() / BRICK_NODES);
+      m_values.resize(m_values.size() + BRICK_NODES);
+    }
+
+    m_table[b] = number;
+    std::fill_n(m_values.begin() + static_cast<size_t>(number) * BRICK_NODES, BRICK_NODES, m_tiles[b]);
+  }
+
+  return &m_values[static_cast<size_t>(m_table[b]) * BRICK_NODES];
+}
+
+template <typename T>
+void SCALAR_POLYGONIZATION::SparseVolume<T>::setTile(const int bi, const int bj, const int bk, const T value)
+{
+  const size_t b = this->brickIndex(bi, bj, bk);
+  if (m_table[b] != TILE) m_free_bricks.push_back(m_table[b]);
+
+  m_table[b] = TILE;
+  m_tiles[b] = value;
+}
+
+namespace
+{
+constexpr int BRICK_SIZE = SCALAR_POLYGONIZATION::SparseVolume<float>::BRICK_SIZE;
+
+//! Side of the block of nodes gathered for a brick: its nodes and the first nodes of its +x, +y, +z neighbours.
+constexpr int BLOCK_SIZE = BRICK_SIZE + 1;
+
+inline int blockIndex(const int i, const int j, const int k)
+{
+  return i + BLOCK_SIZE * (j + BLOCK_SIZE * k);
+}
+
+/*! Gather nodes of brick (bi, bj, bk) and of the first node layers of its +x, +y, +z neighbours, x fastest, and
+ * classify them against `iso_alpha`.
+ *
+ * Nodes of neighbours outside the volume take the value of the first node, they are never used.
+ *
+ * \return false if all nodes are on the same side of the surface.
+ */
+template <typename T>
+bool gatherBlock(const SCALAR_POLYGONIZATION::SparseVolume<T>& volume, const int bi, const int bj, const int bk,
+                 const T iso_alpha, T* block, uint8_t* inside)
+{
+  for (int dk = 0; dk < 2; ++dk)
+    for (int dj = 0; dj < 2; ++dj)
+      for (int di = 0; di < 2; ++di) {
+        const int ni = bi + di, nj = bj + dj, nk = bk + dk;
+        const bool outside = ni >= volume.numBricks(0) || nj >= volume.numBricks(1) || nk >= volume.numBricks(2);
+
+        // Whole brick for (0, 0, 0), its first node layer along each axis stepped into for the neighbours.
+        const int end_i = di ? 1 : BRICK_SIZE, end_j = dj ? 1 : BRICK_SIZE, end_k = dk ? 1 : BRICK_SIZE;
+        const T* values = outside ? nullptr : volume.brick(ni, nj, nk);
+        const T tile = outside ? block[0] : volume.tileValue(ni, nj, nk);
+        for (int k = 0; k < end_k; ++k)
+          for (int j = 0; j < end_j; ++j)
+            for (int i = 0; i < end_i; ++i)
+              block[blockIndex(di * BRICK_SIZE + i, dj * BRICK_SIZE + j, dk * BRICK_SIZE + k)] =
+                  values ? values[i + BRICK_SIZE * (j + BRICK_SIZE * k)] : tile;
+      }
+
+  int num_inside = 0;
+  for (int n = 0; n < BLOCK_SIZE * BLOCK_SIZE * BLOCK_SIZE; ++n) num_inside += inside[n] = block[n] < iso_alpha;
+
+  return num_inside > 0 && num_inside < BLOCK_SIZE * BLOCK_SIZE * BLOCK_SIZE;
+}
+
+/*! Whether cubes of brick (bi, bj, bk), or edges starting at its nodes, may be intersected by the iso-surface.
+ *
+ * True if the brick or one of its +x, +y, +z neighbours is allocated, or if their tile values are on different sides.
+ */
+template <typename T>
+bool isActive(const SCALAR_POLYGONIZATION::SparseVolume<T>& volume, const int bi, const int bj, const int bk,
+              const T iso_alpha)
+{
+  int num_inside = 0, num_bricks = 0;
+  for (int dk = 0; dk < 2; ++dk)
+    for (int dj = 0; dj < 2; ++dj)
+      for (int di = 0; di < 2; ++di) {
+        const int ni = bi + di, nj = bj + dj, nk = bk + dk;
+        if (ni >= volume.numBricks(0) || nj >= volume.numBricks(1) || nk >= volume.numBricks(2)) continue;
+        if (volume.brick(ni, nj, nk)) return true;
+
+        num_inside += volume.tileValue(ni, nj, nk) < iso_alpha;
+        ++num_bricks;
+      }
+
+  return num_inside > 0 && num_inside < num_bricks;
+}
+
+/*! Surface vertices on edges starting at nodes of a brick, and triangles of its cubes.
+ */
+template <typename T>
+struct BrickSurface {
+  std::vector<T> block;                                   //!< Nodes from `gatherBlock`, empty if not intersected.
+  std::vector<uint8_t> inside;                            //!< Classification of `block`.
+  std::vector<uint16_t> edges;                            //!< Intersected edges, `axis + 3 * node`, increasing.
+  std::vector<SCALAR_POLYGONIZATION::Vec3<T>> positions;  //!< Vertex on each intersected edge.
+  std::vector<T> weights;                                 //!< Position of each vertex along its edge, if requested.
+  std::vector<uint32_t> indices;                          //!< Global vertex indices of triangles of the cubes.
+  size_t vertex_begin;                                    //!< Global index of the first vertex.
+  size_t index_begin;                                     //!< Offset of the first index in the mesh.
+};
+}  // namespace
+
+template <typename T>
+SCALAR_POLYGONIZATION::IndexedMesh<T> SCALAR_POLYGONIZATION::polygonizeVolume(const SparseVolume<T>& volume,
+                                                                              const T iso_alpha,
+                                                                              const PolygonizeOptions& options)
+{
+  IndexedMesh<T> mesh;
+
+  const int dims[3] = {volume.dim(0), volume.dim(1), volume.dim(2)};
+  const int num_bricks[3] = {volume.numBricks(0), volume.numBricks(1), volume.numBricks(2)};
+  if (dims[0] < 2 || dims[1] < 2 || dims[2] < 2) return mesh;
+
+  const unsigned num_threads = numThreads(options.num_threads);
+
+  // Active bricks in order, and position of each brick in this list.
+  std::vector<size_t> active;
+  std::vector<uint32_t> active_slot(static_cast<size_t>(num_bricks[0]) * num_bricks[1] * num_bricks[2], UINT32_MAX);
+  for (int bk = 0; bk < num_bricks[2]; ++bk)
+    for (int bj = 0; bj < num_bricks[1]; ++bj)
+      for (int bi = 0; bi < num_bricks[0]; ++bi)
+        if (isActive(volume, bi, bj, bk, iso_alpha)) {
+          const size_t b = bi + num_bricks[0] * (static_cast<size_t>(bj) + num_bricks[1] * static_cast<size_t>(bk));
+          active_slot[b] = static_cast<uint32_t>(active.size());
+          active.push_back(b);
+        }
+
+  auto brickCoordinates = [&](const size_t b, int* brick) {
+    brick[0] = static_cast<int>(b % num_bricks[0]);
+    brick[1] = static_cast<int>(b / num_bricks[0] % num_bricks[1]);
+    brick[2] = static_cast<int>(b / num_bricks[0] / num_bricks[1]);
+  };
+
+  // Vertices: each brick creates those on intersected edges starting at its nodes. Blocks of intersected bricks are
+  // kept for their triangles.
+  std::vector<BrickSurface<T>> surfaces(active.size());
+  parallelFor(active.size(), num_threads, [&](const size_t a) {
+    int brick[3];
+    brickCoordinates(active[a], brick);
+
+    auto& surface = surfaces[a];
+    std::vector<T> block(BLOCK_SIZE * BLOCK_SIZE * BLOCK_SIZE);
+    std::vector<uint8_t> inside(block.size());
+    if (!gatherBlock(volume, brick[0], brick[1], brick[2], iso_alpha, block.data(), inside.data())) return;
+
+    MarchingCubes<T> mc;
+    int node[3];
+    for (int k = 0; k < BRICK_SIZE; ++k)
+      for (int j = 0; j < BRICK_SIZE; ++j)
+        for (int i = 0; i < BRICK_SIZE; ++i) {
+          const int local[3] = {i, j, k};
+          for (int axis = 0; axis < 3; ++axis) node[axis] = brick[axis] * BRICK_SIZE + local[axis];
+          if (node[0] >= dims[0] || node[1] >= dims[1] || node[2] >= dims[2]) continue;
+
+          const int n0 = blockIndex(i, j, k);
+          for (int axis = 0; axis < 3; ++axis) {
+            if (node[axis] + 1 >= dims[axis]) continue;
+            const int n1 = blockIndex(i + (axis == 0), j + (axis == 1), k + (axis == 2));
+            if (inside[n0] == inside[n1]) continue;
+
+            const T s0 = block[n0], s1 = block[n1];
+            const T frac = mc.edgeIntersectionWeight(s0, s1, iso_alpha);
+            T p[3] = {static_cast<T>(node[0]), static_cast<T>(node[1]), static_cast<T>(node[2])};
+            p[axis] += frac;
+            surface.edges.push_back(static_cast<uint16_t>(axis + 3 * (i + BRICK_SIZE * (j + BRICK_SIZE * k))));
+            surface.positions.push_back(volume.position(p[0], p[1], p[2]));
+            if (options.vertex_edges) surface.weights.push_back(frac);
+          }
+        }
+
+    surface.block = std::move(block);
+    surface.inside = std::move(inside);
+  });
+
+  size_t num_vertices = 0;
+  for (auto& surface : surfaces) {
+    surface.vertex_begin = num_vertices;
+    num_vertices += surface.positions.size();
+  }
+  if (num_vertices > static_cast<uint64_t>(UINT32_MAX) + 1)
+    throw std::overflow_error("too many vertices for 32 bit indices");
+
+  // Triangles: cubes of each brick look up vertices of their edges in the bricks owning them.
+  std::array<Vec3<T>, 8> unit_cube;
+  for (int v = 0; v < 8; ++v)
+    unit_cube[v] = Vec3<T>(Convention1::vertexOffset(v, 0), Convention1::vertexOffset(v, 1),
+                           Convention1::vertexOffset(v, 2));
+
+  parallelFor(active.size(), num_threads, [&](const size_t a) {
+    auto& surface = surfaces[a];
+    if (surface.block.empty()) return;
+
+    int brick[3];
+    brickCoordinates(active[a], brick);
+    const T* block = surface.block.data();
+    const uint8_t* inside = surface.inside.data();
+
+    MarchingCubes<T> mc;
+    CubeTriangulation<T> triangulation;
+    std::array<T, 8> scalars;
+
+    for (int k = 0; k < BRICK_SIZE; ++k)
+      for (int j = 0; j < BRICK_SIZE; ++j)
+        for (int i = 0; i < BRICK_SIZE; ++i) {
+          const int cube[3] = {brick[0] * BRICK_SIZE + i, brick[1] * BRICK_SIZE + j, brick[2] * BRICK_SIZE + k};
+          if (cube[0] + 1 >= dims[0] || cube[1] + 1 >= dims[1] || cube[2] + 1 >= dims[2]) continue;
+
+          // Most cubes of a band are on one side of the surface, skip them before gathering their scalars.
+          int corners[8], num_inside = 0;
+          for (int v = 0; v < 8; ++v) {
+            corners[v] = blockIndex(i + Convention1::vertexOffset(v, 0), j + Convention1::vertexOffset(v, 1),
+                                    k + Convention1::vertexOffset(v, 2));
+            num_inside += inside[corners[v]];
+          }
+          if (num_inside == 0 || num_inside == 8) continue;
+
+          for (int v = 0; v < 8; ++v) scalars[v] = block[corners[v]];
+          if (!mc.marchCube(unit_cube.data(), scalars.data(), nullptr, iso_alpha, triangulation)) continue;
+
+          uint32_t slot_to_vertex[CubeTriangulation<T>::MAX_VERTICES];
+          for (int slot = 0; slot < triangulation.num_vertices; ++slot) {
+            // Edge starts at its lower node, along the axis where its two cube vertices differ.
+            const int v0 = Convention1::edgeVertex(triangulation.edges[slot], 0);
+            const int v1 = Convention1::edgeVertex(triangulation.edges[slot], 1);
+            int node[3], axis = 0;
+            for (int d = 0; d < 3; ++d) {
+              const int o0 = Convention1::vertexOffset(v0, d), o1 = Convention1::vertexOffset(v1, d);
+              node[d] = cube[d] + std::min(o0, o1);
+              if (o0 != o1) axis = d;
+            }
+
+            const size_t owner = node[0] / BRICK_SIZE +
+                                 num_bricks[0] * (static_cast<size_t>(node[1] / BRICK_SIZE) +
+                                                  num_bricks[1] * static_cast<size_t>(node[2] / BRICK_SIZE));
+            assert(active_slot[owner] != UINT32_MAX);
+            const auto& owner_surface = surfaces[active_slot[owner]];
+            const int local =
+                node[0] % BRICK_SIZE + BRICK_SIZE * (node[1] % BRICK_SIZE + BRICK_SIZE * (node[2] % BRICK_SIZE));
+            const uint16_t edge = static_cast<uint16_t>(axis + 3 * local);
+            const auto it = std::lower_bound(owner_surface.edges.begin(), owner_surface.edges.end(), edge);
+            assert(it != owner_surface.edges.end() && *it == edge);
+            slot_to_vertex[slot] =
+                static_cast<uint32_t>(owner_surface.vertex_begin + (it - owner_surface.edges.begin()));
+          }
+
+          for (int c = 0; c < 3 * triangulation.num_triangles; ++c)
+            surface.indices.push_back(slot_to_vertex[triangulation.triangles[c]]);
+        }
+
+    std::vector<T>().swap(surface.block);
+    std::vector<uint8_t>().swap(surface.inside);
+  });
+
+  // Concatenate bricks in order.
+  size_t num_indices = 0;
+  for (auto& surface : surfaces) {
+    surface.index_begin = num_indices;
+    num_indices += surface.indices.size();
+  }
+
+  mesh.positions.resize(num_vertices);
+  mesh.indices.resize(num_indices);
+  if (options.vertex_edges) {
+    mesh.edges.resize(num_vertices);
+    mesh.weights.resize(num_vertices);
+  }
+  parallelFor(surfaces.size(), num_threads, [&](const size_t a) {
+    const auto& surface = surfaces[a];
+    std::copy(surface.positions.begin(), surface.positions.end(), mesh.positions.begin() + surface.vertex_begin);
+    std::copy(surface.indices.begin(), surface.indices.end(), mesh.indices.begin() + surface.index_begin);
+    if (!options.vertex_edges) return;
+
+    // Brick local edges to grid edges.
+    int brick[3];
+    brickCoordinates(active[a], brick);
+    for (size_t n = 0; n < surface.edges.size(); ++n) {
+      const int local = surface.edges[n] / 3;
+      const uint64_t node[3] = {static_cast<uint64_t>(brick[0] * BRICK_SIZE + local % BRICK_SIZE),
+                                static_cast<uint64_t>(brick[1] * BRICK_SIZE + local / BRICK_SIZE % BRICK_SIZE),
+                                static_cast<uint64_t>(brick[2] * BRICK_SIZE + local / BRICK_SIZE / BRICK_SIZE)};
+      mesh.edges[surface.vertex_begin + n] =
+          surface.edges[n] % 3 + 3 * (node[0] + dims[0] * (node[1] + static_cast<uint64_t>(dims[1]) * node[2]));
+    }
+    std::copy(surface.weights.begin(), surface.weights.end(), mesh.weights.begin() + surface.vertex_begin);
+  });
+
+  computeVertexNormals(mesh, options.normal_weighting, num_threads);
+
+  return mesh;
+}
+
+template class SCALAR_POLYGONIZATION::SparseVolume<float>;
+template class SCALAR_POLYGONIZATION::SparseVolume<double>;
+template SCALAR_POLYGONIZATION::IndexedMesh<float> SCALAR_POLYGONIZATION::polygonizeVolume<float>(
+    const SparseVolume<float>&, const float, const PolygonizeOptions&);
+template SCALAR_POLYGONIZATION::IndexedMesh<double> SCALAR_POLYGONIZATION::polygonizeVolume<double>(
+    const SparseVolume<double>&, const double, const PolygonizeOptions&);
@@ -0,0 +1,353 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright 2019 Lakshman Anumolu.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///////////////////////////////////////////////////////////////////////////////
+
+#include "scalar_polygonization/volume_file.h"
+
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+namespace
+{
+size_t scalarSize(const SCALAR_POLYGONIZATION::ScalarType type)
+{
+  using SCALAR_POLYGONIZATION::ScalarType;
+
+  switch (type) {
+    case ScalarType::UINT8:
+      return 1;
+    case ScalarType::UINT16:
+      return 2;
+    case ScalarType::FLOAT:
+      return 4;
+    case ScalarType::DOUBLE:
+      return 8;
+  }
+  return 0;
+}
+
+template <typename S>
+SCALAR_POLYGONIZATION::ScalarType scalarType();
+
+template <>
+SCALAR_POLYGONIZATION::ScalarType scalarType<uint8_t>()
+{
+  return SCALAR_POLYGONIZATION::ScalarType::UINT8;
+}
+
+template <>
+SCALAR_POLYGONIZATION::ScalarType scalarType<uint16_t>()
+{
+  return SCALAR_POLYGONIZATION::ScalarType::UINT16;
+}
+
+template <>
+SCALAR_POLYGONIZATION::ScalarType scalarType<float>()
+{
+  return SCALAR_POLYGONIZATION::ScalarType::FLOAT;
+}
+
+template <>
+SCALAR_POLYGONIZATION::ScalarType scalarType<double>()
+{
+  return SCALAR_POLYGONIZATION::ScalarType::DOUBLE;
+}
+
+//! NRRD type names of the supported types.
+SCALAR_POLYGONIZATION::ScalarType nrrdType(const std::string& name)
+{
+  using SCALAR_POLYGONIZATION::ScalarType;
+
+  if (name == "uchar" || name == "unsigned char" || name == "uint8" || name == "uint8_t") return ScalarType::UINT8;
+  if (name == "ushort" || name == "unsigned short" || name == "unsigned short int" || name == "uint16" ||
+      name == "uint16_t")
+    return ScalarType::UINT16;
+  if (name == "float") return ScalarType::FLOAT;
+  if (name == "double") return ScalarType::DOUBLE;
+
+  throw std::runtime_error("unsupported NRRD type: " + name);
+}
+
+//! Numbers of a field value, with vector parentheses and commas taken as separators.
+std::vector<double> nrrdNumbers(std::string value)
+{
+  for (auto& c : value)
+    if (c == '(' || c == ')' || c == ',') c = ' ';
+
+  std::vector<double> numbers;
+  std::istringstream stream(value);
+  for (double number; stream >> number;) numbers.push_back(number);
+  return numbers;
+}
+
+//! Integer value of field `key`, malformed values throw `std::runtime_error`.
+long nrrdInteger(const std::string& path, const std::string& key, const std::string& value)
+{
+  size_t end = 0;
+  long number = 0;
+  try {
+    number = std::stol(value, &end);
+  } catch (const std::logic_error&) {
+    end = 0;
+  }
+  if (end == 0 || value.find_first_not_of(' ', end) != std::string::npos)
+    throw std::runtime_error(path + ": malformed " + key + ": " + value);
+  return number;
+}
+
+//! Convert `count` values of type S stored at any address to T.
+template <typename S, typename T>
+void readValues(const char* bytes, const size_t count, T* values)
+{
+  for (size_t n = 0; n < count; ++n) {
+    S value;
+    memcpy(&value, bytes + n * sizeof(S), sizeof(S));
+    values[n] = static_cast<T>(value);
+  }
+}
+
+bool littleEndianHost()
+{
+  const uint16_t one = 1;
+  uint8_t first;
+  memcpy(&first, &one, 1);
+  return first == 1;
+}
+}  // namespace
+
+SCALAR_POLYGONIZATION::VolumeFile::VolumeFile(const std::string& path, const ScalarType type, const Vec3<int>& dims,
+                                              const size_t offset)
+    : m_type(type), m_mapping(nullptr), m_mapping_size(0), m_values(nullptr), m_aligned(true)
+{
+  for (int axis = 0; axis < 3; ++axis) {
+    m_dims[axis] = dims[axis];
+    m_origin[axis] = 0.;
+    m_spacing[axis] = 1.;
+  }
+
+  this->open(path, offset, false);
+}
+
+SCALAR_POLYGONIZATION::VolumeFile::VolumeFile(const std::string& path)
+    : m_type(ScalarType::UINT8), m_mapping(nullptr), m_mapping_size(0), m_values(nullptr), m_aligned(true)
+{
+  std::ifstream file(path, std::ios::binary);
+  if (!file) throw std::runtime_error("cannot open " + path);
+
+  std::string line;
+  if (!std::getline(file, line) || line.compare(0, 7, "NRRD000") != 0)
+    throw std::runtime_error(path + " is not an NRRD file");
+
+  for (int axis = 0; axis < 3; ++axis) {
+    m_dims[axis] = 0;
+    m_origin[axis] = 0.;
+    m_spacing[axis] = 1.;
+  }
+
+  bool has_type = false, has_sizes = false;
+  std::string data_file;
+  long byte_skip = 0;
+  bool empty_line = false;
+
+  // Fields up to the first empty line, the attached data follows it.
+  while (std::getline(file, line)) {
+    if (line.empty() || line == "\r") {
+      empty_line = true;
+      break;
+    }
+    if (line[0] == '#') continue;
+
+    const size_t colon = line.find(": ");
+    if (colon == std::string::npos) continue;  // Key/value pairs (`key:=value`) are ignored.
+
+    const std::string key = line.substr(0, colon);
+    std::string value = line.substr(colon + 2);
+    if (!value.empty() && value.back() == '\r') value.pop_back();
+
+    if (key == "type") {
+      m_type = nrrdType(value);
+      has_type = true;
+    } else if (key == "dimension") {
+      if (value != "3") throw std::runtime_error(path + ": only 3 dimensional volumes are supported");
+    } else if (key == "sizes") {
+      const auto sizes = nrrdNumbers(value);
+      if (sizes.size() != 3) throw std::runtime_error(path + ": expected 3 sizes");
+      for (int axis = 0; axis < 3; ++axis) m_dims[axis] = static_cast<int>(sizes[axis]);
+      has_sizes = true;
+    } else if (key == "encoding") {
+      if (value != "raw") throw std::runtime_error(path + ": unsupported encoding " + value);
+    } else if (key == "endian") {
+      if ((value == "little") != littleEndianHost()) throw std::runtime_error(path + ": byte order differs from host");
+    } else if (key == "spacings") {
+      const auto spacings = nrrdNumbers(value);
+      if (spacings.size() != 3) throw std::runtime_error(path + ": expected 3 spacings");
+      for (int axis = 0; axis < 3; ++axis) m_spacing[axis] = spacings[axis];
+    } else if (key == "space directions") {
+      const auto directions = nrrdNumbers(value);
+      if (directions.size() != 9) throw std::runtime_error(path + ": expected 3 space directions");
+      for (int axis = 0; axis < 3; ++axis)
+        for (int component = 0; component < 3; ++component)
+          if (component != axis && directions[3 * axis + component] != 0.)
+            throw std::runtime_error(path + ": space directions must be axis aligned");
+      for (int axis = 0; axis < 3; ++axis) m_spacing[axis] = directions[4 * axis];
+    } else if (key == "space origin") {
+      const auto origin = nrrdNumbers(value);
+      if (origin.size() != 3) throw std::runtime_error(path + ": expected a 3 component space origin");
+      for (int axis = 0; axis < 3; ++axis) m_origin[axis] = origin[axis];
+    } else if (key == "data file" || key == "datafile") {
+      data_file = value;
+    } else if (key == "byte skip") {
+      byte_skip = nrrdInteger(path, key, value);
+    } else if (key == "line skip") {
+      if (nrrdInteger(path, key, value) != 0) throw std::runtime_error(path + ": line skip is not supported");
+    }
+  }
+
+  if (!has_type || !has_sizes) throw std::runtime_error(path + ": type and sizes are required");
+
+  if (data_file.empty()) {
+    // Attached data starts right after the header.
+    if (byte_skip < 0) throw std::runtime_error(path + ": byte skip -1 needs a detached data file");
+    if (!empty_line) throw std::runtime_error(path + ": header does not end with an empty line");
+    const std::streamoff header_size = file.tellg();
+    if (header_size < 0) throw std::runtime_error(path + ": cannot find the end of the header");
+    this->open(path, static_cast<size_t>(header_size) + static_cast<size_t>(byte_skip), false);
+    return;
+  }
+
+  if (data_file.compare(0, 4, "LIST") == 0) throw std::runtime_error(path + ": data file lists are not supported");
+
+  // Detached data file, relative to the directory of the header.
+  const size_t slash = path.find_last_of('/');
+  if (data_file[0] != '/' && slash != std::string::npos) data_file = path.substr(0, slash + 1) + data_file;
+
+  // Byte skip -1 means the values end the file.
+  this->open(data_file, byte_skip < 0 ? 0 : static_cast<size_t>(byte_skip), byte_skip < 0);
+}
+
+SCALAR_POLYGONIZATION::VolumeFile::~VolumeFile()
+{
+  if (m_mapping) munmap(m_mapping, m_mapping_size);
+}
+
+void SCALAR_POLYGONIZATION::VolumeFile::open(const std::string& path, const size_t offset, const bool offset_from_end)
+{
+  for (int axis = 0; axis < 3; ++axis)
+    if (m_dims[axis] < 0) throw std::runtime_error(path + ": negative size");
+
+  const size_t value_size = scalarSize(m_type);
+  const size_t data_size = value_size * static_cast<size_t>(m_dims[0]) * m_dims[1] * m_dims[2];
+
+  const int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0) throw std::runtime_error("cannot open " + path);
+
+  struct stat status;
+  if (fstat(fd, &status) != 0) {
+    close(fd);
+    throw std::runtime_error("cannot stat " + path);
+  }
+  const size_t file_size = static_cast<size_t>(status.st_size);
+  const size_t begin = offset_from_end ? file_size - std::min(file_size, data_size) : offset;
+
+  if (begin > file_size || data_size > file_size - begin) {
+    close(fd);
+    throw std::runtime_error(path + " is too small for the volume");
+  }
+
+  if (data_size == 0) {
+    close(fd);
+    return;
+  }
+
+  void* mapping = mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (mapping == MAP_FAILED) throw std::runtime_error("cannot map " + path);
+
+  m_mapping = mapping;
+  m_mapping_size = file_size;
+  madvise(mapping, file_size, MADV_SEQUENTIAL);
+
+  m_values = static_cast<const char*>(mapping) + begin;
+  m_aligned = begin % value_size == 0;
+}
+
+template <typename T, typename S>
+SCALAR_POLYGONIZATION::ScalarVolume<T, S> SCALAR_POLYGONIZATION::VolumeFile::volume() const
+{
+  if (scalarType<S>() != m_type) throw std::runtime_error("volume requested with a type different from the file");
+  if (!m_aligned) throw std::runtime_error("values are not aligned to their size in the file, use planeSampler()");
+
+  return ScalarVolume<T, S>(reinterpret_cast<const S*>(m_values), this->dims(),
+                            Vec3<T>(static_cast<T>(m_origin[0]), static_cast<T>(m_origin[1]),
+                                    static_cast<T>(m_origin[2])),
+                            Vec3<T>(static_cast<T>(m_spacing[0]), static_cast<T>(m_spacing[1]),
+                                    static_cast<T>(m_spacing[2])));
+}
+
+template <typename T>
+SCALAR_POLYGONIZATION::PlaneSampler<T> SCALAR_POLYGONIZATION::VolumeFile::planeSampler() const
+{
+  return [this](const int k, T* values) {
+    const size_t plane_size = static_cast<size_t>(m_dims[0]) * m_dims[1];
+    const char* plane = m_values + static_cast<size_t>(k) * plane_size * scalarSize(m_type);
+
+    switch (m_type) {
+      case ScalarType::UINT8:
+        readValues<uint8_t>(plane, plane_size, values);
+        break;
+      case ScalarType::UINT16:
+        readValues<uint16_t>(plane, plane_size, values);
+        break;
+      case ScalarType::FLOAT:
+        readValues<float>(plane, plane_size, values);
+        break;
+      case ScalarType::DOUBLE:
+        readValues<double>(plane, plane_size, values);
+        break;
+    }
+  };
+}
+
+template SCALAR_POLYGONIZATION::ScalarVolume<float> SCALAR_POLYGONIZATION::VolumeFile::volume<float, float>() const;
+template SCALAR_POLYGONIZATION::ScalarVolume<float, uint8_t> SCALAR_POLYGONIZATION::VolumeFile::volume<float, uint8_t>()
+    const;
+template SCALAR_POLYGONIZATION::ScalarVolume<float, uint16_t>
+SCALAR_POLYGONIZATION::VolumeFile::volume<float, uint16_t>() const;
+template SCALAR_POLYGONIZATION::ScalarVolume<double> SCALAR_POLYGONIZATION::VolumeFile::volume<double, double>() const;
+template SCALAR_POLYGONIZATION::PlaneSampler<float> SCALAR_POLYGONIZATION::VolumeFile::planeSampler<float>() const;
+template SCALAR_POLYGONIZATION::PlaneSampler<double> SCALAR_POLYGONIZATION::VolumeFile::planeSampler<double>() const;
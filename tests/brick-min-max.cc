@@ -0,0 +1,129 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright 2019 Lakshman Anumolu.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///////////////////////////////////////////////////////////////////////////////
+
+#include "scalar_polygonization/brick_min_max.h"
+#include "scalar_polygonization/polygonize_volume.h"
+#include "scalar_polygonization/vec3.h"
+#include "test_utilities.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+namespace SP = SCALAR_POLYGONIZATION;
+namespace SPT = SCALAR_POLYGONIZATION_TESTS;
+
+namespace
+{
+using T = float;
+
+//! Check brick ranges against all nodes of their cubes.
+void checkBricks(const SP::ScalarVolume<T>& volume, const SP::BrickMinMax<T>& bricks)
+{
+  const int brick_size = SP::BrickMinMax<T>::BRICK_SIZE;
+
+  for (int axis = 0; axis < 3; ++axis)
+    EXPECT_EQ(bricks.numBricks(axis), (volume.dim(axis) - 1 + brick_size - 1) / brick_size);
+
+  for (int bk = 0; bk < bricks.numBricks(2); ++bk)
+    for (int bj = 0; bj < bricks.numBricks(1); ++bj)
+      for (int bi = 0; bi < bricks.numBricks(0); ++bi) {
+        T min = volume(bi * brick_size, bj * brick_size, bk * brick_size), max = min;
+        for (int k = bk * brick_size; k <= std::min((bk + 1) * brick_size, volume.dim(2) - 1); ++k)
+          for (int j = bj * brick_size; j <= std::min((bj + 1) * brick_size, volume.dim(1) - 1); ++j)
+            for (int i = bi * brick_size; i <= std::min((bi + 1) * brick_size, volume.dim(0) - 1); ++i) {
+              min = std::min(min, volume(i, j, k));
+              max = std::max(max, volume(i, j, k));
+            }
+        EXPECT_EQ(bricks.min(bi, bj, bk), min);
+        EXPECT_EQ(bricks.max(bi, bj, bk), max);
+      }
+}
+}  // namespace
+
+TEST(SCALAR_POLYGONIZATION, BRICK_MIN_MAX)
+{
+  // Strided sub-block with ghost layers, dimensions not multiple of the brick size.
+  const SP::Vec3<int> dims(30, 17, 25);
+  const int ghost = 1;
+  const SP::Vec3<size_t> strides(1, dims[0] + 2 * ghost, (dims[0] + 2 * ghost) * (dims[1] + 2 * ghost));
+  std::vector<T> field(strides[2] * (dims[2] + 2 * ghost));
+
+  const T dx = static_cast<T>(0.1);
+  auto fill = [&](const T radius, const SP::Vec3<int>& begin, const SP::Vec3<int>& end) {
+    for (int k = begin[2]; k < end[2]; ++k)
+      for (int j = begin[1]; j < end[1]; ++j)
+        for (int i = begin[0]; i < end[0]; ++i) {
+          const T x = i * dx - 1.5, y = j * dx - 0.8, z = k * dx - 1.2;
+          field[(i + ghost) * strides[0] + (j + ghost) * strides[1] + (k + ghost) * strides[2]] =
+              std::sqrt(x * x + y * y + z * z) - radius;
+        }
+  };
+  fill(0.5, SP::Vec3<int>(0, 0, 0), dims);
+
+  const SP::ScalarVolume<T> volume(field.data(), dims, strides, ghost, SP::Vec3<T>(0, 0, 0),
+                                   SP::Vec3<T>(dx, dx, dx));
+  SP::BrickMinMax<T> bricks(volume, 3);
+  checkBricks(volume, bricks);
+
+  for (const auto extraction :
+       {SP::PolygonizeOptions::Extraction::SINGLE_PASS, SP::PolygonizeOptions::Extraction::COUNT_THEN_FILL})
+    for (const unsigned num_threads : {1u, 3u}) {
+      SP::PolygonizeOptions options;
+      options.num_threads = num_threads;
+      options.extraction = extraction;
+      for (const T iso_alpha : {-0.2, 0., 0.3}) {
+        const auto mesh = SP::polygonizeVolume(volume, bricks, iso_alpha, options);
+        EXPECT_GT(mesh.numTriangles(), 0u);
+        SPT::expectIdenticalMeshes(SP::polygonizeVolume(volume, iso_alpha, options), mesh);
+      }
+    }
+
+  // Grow the sphere in a sub-block touching brick faces, only bricks around it are recomputed.
+  const SP::Vec3<int> begin(8, 3, 9), end(21, 17, 17);
+  fill(0.9, begin, end);
+  bricks.update(volume, begin, end);
+  checkBricks(volume, bricks);
+  SPT::expectIdenticalMeshes(SP::polygonizeVolume(volume, static_cast<T>(0.)),
+                             SP::polygonizeVolume(volume, bricks, static_cast<T>(0.)));
+
+  // Ranges of a volume of other dimensions, larger or smaller, are rejected.
+  const std::vector<T> small_field(9 * 9 * 9, 1), large_field(33 * 33 * 33, 1);
+  const SP::ScalarVolume<T> small(small_field.data(), SP::Vec3<int>(9, 9, 9), SP::Vec3<T>(0, 0, 0),
+                                  SP::Vec3<T>(1, 1, 1));
+  const SP::ScalarVolume<T> large(large_field.data(), SP::Vec3<int>(33, 33, 33), SP::Vec3<T>(0, 0, 0),
+                                  SP::Vec3<T>(1, 1, 1));
+  EXPECT_THROW(SP::polygonizeVolume(small, SP::BrickMinMax<T>(large), static_cast<T>(0.)), std::invalid_argument);
+  EXPECT_THROW(SP::polygonizeVolume(large, SP::BrickMinMax<T>(small), static_cast<T>(0.)), std::invalid_argument);
+}
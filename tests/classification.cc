@@ -0,0 +1,158 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright 2019 Lakshman Anumolu.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///////////////////////////////////////////////////////////////////////////////
+
+#include "scalar_polygonization/classification.h"
+#include "scalar_polygonization/tables.h"
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <string.h>
+#include <vector>
+
+namespace SP = SCALAR_POLYGONIZATION;
+
+namespace
+{
+template <typename T>
+void checkClassification(const int num_nodes, const size_t stride, std::mt19937& generator)
+{
+  std::uniform_real_distribution<T> distribution(-1, 1);
+  const T iso_alpha = 0.25;
+
+  // Four node rows (j, k), (j + 1, k), (j, k + 1), (j + 1, k + 1).
+  std::vector<T> rows[4];
+  std::vector<uint64_t> bits[4];
+  for (int r = 0; r < 4; ++r) {
+    rows[r].resize(num_nodes * stride);
+    for (auto& value : rows[r]) value = distribution(generator);
+    // Exact iso values are inside, as in MarchingCubes::marchCube.
+    rows[r][0] = iso_alpha;
+
+    bits[r].resize(SP::classificationWords(num_nodes));
+    SP::classifyNodes(rows[r].data(), stride, num_nodes, iso_alpha, bits[r].data());
+
+    for (int i = 0; i < num_nodes; ++i)
+      EXPECT_EQ((bits[r][i / 64] >> (i % 64)) & 1, static_cast<uint64_t>(rows[r][i * stride] < iso_alpha));
+  }
+
+  std::vector<int> cubes(num_nodes);
+  std::vector<uint8_t> cases(num_nodes);
+  const int num_active = SP::activeCubes(bits[0].data(), bits[1].data(), bits[2].data(), bits[3].data(),
+                                         num_nodes - 1, cubes.data(), cases.data());
+
+  int a = 0;
+  for (int i = 0; i < num_nodes - 1; ++i) {
+    int vertex_flag = 0;
+    for (int v = 0; v < 8; ++v) {
+      const int r = static_cast<int>(SP::vertex_offset[v][1]) + 2 * static_cast<int>(SP::vertex_offset[v][2]);
+      const int node = i + static_cast<int>(SP::vertex_offset[v][0]);
+      if (rows[r][node * stride] < iso_alpha) vertex_flag |= (1 << v);
+    }
+    if (SP::edge_table[vertex_flag] == 0) continue;
+
+    ASSERT_LT(a, num_active);
+    EXPECT_EQ(cubes[a], i);
+    EXPECT_EQ(cases[a], vertex_flag);
+    ++a;
+  }
+  EXPECT_EQ(a, num_active);
+
+  int along_row = 0, between_rows = 0;
+  for (int i = 0; i < num_nodes; ++i) {
+    const bool inside = rows[0][i * stride] < iso_alpha;
+    if (i + 1 < num_nodes && inside != (rows[0][(i + 1) * stride] < iso_alpha)) ++along_row;
+    if (inside != (rows[1][i * stride] < iso_alpha)) ++between_rows;
+  }
+  EXPECT_EQ(SP::crossedEdgesAlongRow(bits[0].data(), num_nodes), along_row);
+  EXPECT_EQ(SP::crossedEdgesBetweenRows(bits[0].data(), bits[1].data(), num_nodes), between_rows);
+}
+}  // namespace
+
+TEST(SCALAR_POLYGONIZATION, CLASSIFICATION)
+{
+  std::mt19937 generator(7);
+
+  for (const int num_nodes : {2, 3, 8, 63, 64, 65, 127, 128, 129, 200}) {
+    checkClassification<float>(num_nodes, 1, generator);
+    checkClassification<float>(num_nodes, 3, generator);
+    checkClassification<double>(num_nodes, 1, generator);
+    checkClassification<double>(num_nodes, 2, generator);
+  }
+}
+
+TEST(SCALAR_POLYGONIZATION, CLASSIFICATION_THRESHOLD)
+{
+  const std::vector<float> iso_alphas = {-3.f, 0.f, 0.25f, 1.f, 99.5f, 255.f, 255.5f, 256.f, 4000.25f, 65535.f, 7e4f};
+
+  for (const float iso_alpha : iso_alphas) {
+    uint8_t threshold_8;
+    const bool has_threshold_8 = SP::classificationThreshold(iso_alpha, threshold_8);
+    for (int value = 0; value < 256; ++value)
+      EXPECT_EQ(has_threshold_8 ? value < threshold_8 : true, static_cast<float>(value) < iso_alpha);
+
+    uint16_t threshold_16;
+    const bool has_threshold_16 = SP::classificationThreshold(iso_alpha, threshold_16);
+    for (int value = 0; value < 65536; ++value)
+      EXPECT_EQ(has_threshold_16 ? value < threshold_16 : true, static_cast<float>(value) < iso_alpha);
+
+#if defined(SP_HAS_FLOAT16)
+    _Float16 threshold;
+    EXPECT_TRUE(SP::classificationThreshold(iso_alpha, threshold));
+    for (int bits = 0; bits < 65536; ++bits) {
+      _Float16 value;
+      const uint16_t half = static_cast<uint16_t>(bits);
+      memcpy(&value, &half, sizeof(value));
+      EXPECT_EQ(value < threshold, static_cast<float>(value) < iso_alpha);
+    }
+#endif
+  }
+
+  // Integer rows against the vectorized loops.
+  std::mt19937 generator(11);
+  std::uniform_int_distribution<int> distribution(0, 65535);
+  for (const int num_nodes : {3, 16, 17, 64, 100, 129}) {
+    std::vector<uint16_t> row_16(num_nodes);
+    std::vector<uint8_t> row_8(num_nodes);
+    for (int i = 0; i < num_nodes; ++i) {
+      row_16[i] = static_cast<uint16_t>(distribution(generator));
+      row_8[i] = static_cast<uint8_t>(row_16[i] >> 8);
+    }
+
+    std::vector<uint64_t> bits_16(SP::classificationWords(num_nodes)), bits_8(SP::classificationWords(num_nodes));
+    SP::classifyNodes(row_16.data(), 1, num_nodes, static_cast<uint16_t>(40000), bits_16.data());
+    SP::classifyNodes(row_8.data(), 1, num_nodes, static_cast<uint8_t>(200), bits_8.data());
+    for (int i = 0; i < num_nodes; ++i) {
+      EXPECT_EQ((bits_16[i / 64] >> (i % 64)) & 1, static_cast<uint64_t>(row_16[i] < 40000));
+      EXPECT_EQ((bits_8[i / 64] >> (i % 64)) & 1, static_cast<uint64_t>(row_8[i] < 200));
+    }
+  }
+}
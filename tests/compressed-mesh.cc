@@ -0,0 +1,153 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright 2019 Lakshman Anumolu.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///////////////////////////////////////////////////////////////////////////////
+
+#include "scalar_polygonization/compressed_mesh.h"
+#include "scalar_polygonization/polygonize_volume.h"
+#include "scalar_polygonization/vec3.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+namespace SP = SCALAR_POLYGONIZATION;
+
+TEST(SCALAR_POLYGONIZATION, COMPRESSED_MESH)
+{
+  using T = float;
+
+  const SP::Vec3<int> dims(41, 37, 43);
+  const SP::Vec3<T> origin(-1.5, -1.25, -1.75), spacing(0.075, 0.07, 0.08);
+  std::vector<T> field;
+  for (int k = 0; k < dims[2]; ++k)
+    for (int j = 0; j < dims[1]; ++j)
+      for (int i = 0; i < dims[0]; ++i) {
+        const T x = origin[0] + i * spacing[0], y = origin[1] + j * spacing[1], z = origin[2] + k * spacing[2];
+        field.push_back(std::sin(3 * x) + std::cos(2 * y) + std::sin(4 * z) + x * x);
+      }
+  const SP::ScalarVolume<T> volume(field.data(), dims, origin, spacing);
+  SP::PolygonizeOptions options;
+  options.num_threads = 3;
+  options.vertex_edges = true;
+  const auto mesh = SP::polygonizeVolume(volume, static_cast<T>(0.5), options);
+  ASSERT_GT(mesh.numTriangles(), 1000u);
+
+  // Vertices lie on their edges, at their weight.
+  ASSERT_EQ(mesh.edges.size(), mesh.numVertices());
+  ASSERT_EQ(mesh.weights.size(), mesh.numVertices());
+  for (size_t v = 0; v < mesh.numVertices(); ++v) {
+    const int edge_axis = static_cast<int>(mesh.edges[v] % 3);
+    const uint64_t node = mesh.edges[v] / 3;
+    const uint64_t ijk[3] = {node % dims[0], node / dims[0] % dims[1], node / dims[0] / dims[1]};
+    ASSERT_LT(ijk[2], static_cast<uint64_t>(dims[2]));
+    EXPECT_GE(mesh.weights[v], 0);
+    EXPECT_LE(mesh.weights[v], 1);
+    for (int axis = 0; axis < 3; ++axis)
+      EXPECT_NEAR(mesh.positions[v][axis],
+                  origin[axis] + (ijk[axis] + (axis == edge_axis ? mesh.weights[v] : 0)) * spacing[axis], 1e-5);
+  }
+
+  // Same edges and weights for any extraction mode and number of threads.
+  for (const unsigned num_threads : {1u, 2u}) {
+    SP::PolygonizeOptions other_options = options;
+    other_options.num_threads = num_threads;
+    other_options.extraction = SP::PolygonizeOptions::Extraction::COUNT_THEN_FILL;
+    const auto other = SP::polygonizeVolume(volume, static_cast<T>(0.5), other_options);
+    EXPECT_EQ(other.edges, mesh.edges);
+    EXPECT_EQ(other.weights, mesh.weights);
+  }
+
+  for (const int weight_bits : {16, 12, 8}) {
+    const auto data = SP::compressMesh(mesh, dims, origin, spacing, weight_bits);
+    const auto decoded = SP::decompressMesh<T>(data.data(), data.size());
+
+    EXPECT_EQ(decoded.indices, mesh.indices);
+    ASSERT_EQ(decoded.numVertices(), mesh.numVertices());
+    EXPECT_TRUE(decoded.normals.empty());
+    EXPECT_EQ(decoded.edges, mesh.edges);
+
+    // Half a quantization step along the edge, plus float rounding of the original position.
+    const double step = 1. / ((1 << weight_bits) - 1);
+    for (size_t v = 0; v < mesh.numVertices(); ++v)
+      for (int axis = 0; axis < 3; ++axis)
+        EXPECT_NEAR(decoded.positions[v][axis], mesh.positions[v][axis], spacing[axis] * (step / 2 + 1e-5));
+
+    // Much smaller than float positions and 32 bit indices.
+    const size_t raw_size = sizeof(T) * 3 * mesh.numVertices() + sizeof(uint32_t) * mesh.indices.size();
+    EXPECT_LT(3 * data.size(), raw_size);
+  }
+
+  const auto data = SP::compressMesh(mesh, dims, origin, spacing);
+  EXPECT_THROW(SP::decompressMesh<T>(data.data(), data.size() - 1), std::runtime_error);
+  EXPECT_THROW(SP::decompressMesh<T>(data.data() + 1, data.size() - 1), std::runtime_error);
+
+  SP::IndexedMesh<T> without_edges = mesh;
+  without_edges.edges.clear();
+  EXPECT_THROW(SP::compressMesh(without_edges, dims, origin, spacing), std::runtime_error);
+  for (const int weight_bits : {0, 17})
+    EXPECT_THROW(SP::compressMesh(mesh, dims, origin, spacing, weight_bits), std::runtime_error);
+}
+
+TEST(SCALAR_POLYGONIZATION, COMPRESSED_MESH_CORRUPT)
+{
+  using T = float;
+
+  // A vertex on the x-edge of node (1, 2, 2), in the last cube of a 3^3 grid.
+  const SP::Vec3<int> dims(3, 3, 3);
+  SP::IndexedMesh<T> mesh;
+  mesh.positions.push_back(SP::Vec3<T>(1.5, 2, 2));
+  mesh.edges.push_back(0 + 3 * (1 + 3 * (2 + 3 * 2)));
+  mesh.weights.push_back(0.5);
+  const auto data = SP::compressMesh(mesh, dims, SP::Vec3<T>(0, 0, 0), SP::Vec3<T>(1, 1, 1), 12);
+
+  const auto decoded = SP::decompressMesh<T>(data.data(), data.size());
+  ASSERT_EQ(decoded.numVertices(), 1u);
+  for (int axis = 0; axis < 3; ++axis) EXPECT_NEAR(decoded.positions[0][axis], mesh.positions[0][axis], 1e-3);
+  EXPECT_EQ(decoded.edges, mesh.edges);
+
+  // Sizes follow magic, version and weight bits, one byte each. Without triangles, the data ends with the weight.
+  const size_t sizes = 6;
+
+  // Cube outside of a smaller grid.
+  auto smaller = data;
+  smaller[sizes + 2] = 2;
+  EXPECT_THROW(SP::decompressMesh<T>(smaller.data(), smaller.size()), std::runtime_error);
+
+  // Weight above 2^12 - 1.
+  auto heavy = data;
+  heavy.back() = 0xff;
+  EXPECT_THROW(SP::decompressMesh<T>(heavy.data(), heavy.size()), std::runtime_error);
+
+  // Edge outside of the grid.
+  mesh.edges[0] = 3 * 27;
+  EXPECT_THROW(SP::compressMesh(mesh, dims, SP::Vec3<T>(0, 0, 0), SP::Vec3<T>(1, 1, 1)), std::runtime_error);
+}
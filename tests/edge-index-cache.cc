@@ -0,0 +1,81 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright 2019 Lakshman Anumolu.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///////////////////////////////////////////////////////////////////////////////
+
+#include "scalar_polygonization/edge_index_cache.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+namespace SP = SCALAR_POLYGONIZATION;
+
+TEST(SCALAR_POLYGONIZATION, EDGE_INDEX_CACHE)
+{
+  SP::EdgeIndexCache cache(4, 3);
+
+  EXPECT_EQ(cache(0, 1, 1), SP::EdgeIndexCache::INVALID);
+
+  // Edges shared by neighbouring cubes within a layer.
+  cache(1, 0, 0) = 1;
+  EXPECT_EQ(cache(3, 1, 0), 1u);
+  cache(2, 1, 0) = 2;
+  EXPECT_EQ(cache(0, 1, 1), 2u);
+  cache(10, 1, 1) = 3;
+  EXPECT_EQ(cache(11, 2, 1), 3u);
+  EXPECT_EQ(cache.edge(2, 2, 2, false), 3u);
+
+  // Top plane of a layer becomes bottom plane of the next one, z-edges are not shared between layers.
+  cache(6, 2, 1) = 4;
+  cache.advance();
+  EXPECT_EQ(cache(2, 2, 1), 4u);
+  EXPECT_EQ(cache(0, 1, 1), SP::EdgeIndexCache::INVALID);
+  EXPECT_EQ(cache(11, 2, 1), SP::EdgeIndexCache::INVALID);
+  EXPECT_EQ(cache(6, 2, 1), SP::EdgeIndexCache::INVALID);
+
+  cache.reset();
+  EXPECT_EQ(cache(2, 2, 1), SP::EdgeIndexCache::INVALID);
+}
+
+TEST(SCALAR_POLYGONIZATION, EDGE_INDEX_CACHE_CONVENTION_2)
+{
+  SP::EdgeIndexCache cache(4, 3, SP::Convention2());
+
+  // Every cube edge maps to the grid edge between its two vertices.
+  for (int edge = 0; edge < 12; ++edge) {
+    const int v0 = SP::Convention2::edgeVertex(edge, 0), v1 = SP::Convention2::edgeVertex(edge, 1);
+    int axis = 0, node[3];
+    for (int a = 0; a < 3; ++a) {
+      if (SP::Convention2::vertexOffset(v0, a) != SP::Convention2::vertexOffset(v1, a)) axis = a;
+      node[a] = std::min(SP::Convention2::vertexOffset(v0, a), SP::Convention2::vertexOffset(v1, a));
+    }
+    EXPECT_EQ(&cache(edge, 1, 1), &cache.edge(axis, 1 + node[0], 1 + node[1], node[2] == 1));
+  }
+}
@@ -0,0 +1,118 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright 2019 Lakshman Anumolu.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include "array.h"
+#include "grid.h"
+#include "stencil.h"
+#include "scalar_polygonization/vec3.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <stdexcept>
+
+namespace
+{
+using T = double;
+using ScalarArray = EXAMPLES::Array<EXAMPLES::Grid<T, 3>, T>;
+using VectorArray = EXAMPLES::Array<EXAMPLES::Grid<T, 3>, SCALAR_POLYGONIZATION::Vec3<T>>;
+
+const SCALAR_POLYGONIZATION::Vec3<T> CENTER(0.52, 0.47, 0.55);
+const T RADIUS = 0.3;
+
+//! Distance from the sphere of radius `RADIUS` around `CENTER`, at all nodes including ghost nodes.
+void sphereDistance(ScalarArray& field)
+{
+  const auto& grid = field.grid();
+  const auto num_cells = grid.numCells();
+  const int pad = grid.getPadding();
+  for (int k = -pad; k < num_cells[2] + pad; ++k)
+    for (int j = -pad; j < num_cells[1] + pad; ++j)
+      for (int i = -pad; i < num_cells[0] + pad; ++i) field(i, j, k) = (grid(i, j, k) - CENTER).mag() - RADIUS;
+}
+}  // namespace
+
+TEST(SCALAR_POLYGONIZATION, EXAMPLES_STENCIL)
+{
+  // Cells along each axis do not divide into whole tiles.
+  EXAMPLES::Grid<T, 3> grid(40, 44, 70);
+  grid.generate(0, 1, 0, 1.1, 0, 1.75);
+  const auto num_cells = grid.numCells();
+  const auto dx = grid.dX();
+
+  ScalarArray field(grid);
+  sphereDistance(field);
+
+  VectorArray gradient(grid), threaded_gradient(grid, 3);
+  ScalarArray laplacian(grid), threaded_laplacian(grid, 3), curvature(grid), threaded_curvature(grid, 3);
+  EXAMPLES::computeGradient(field, gradient, static_cast<T>(-1.));
+  EXAMPLES::computeGradient(field, threaded_gradient, static_cast<T>(-1.), 3);
+  EXAMPLES::computeLaplacian(field, laplacian);
+  EXAMPLES::computeLaplacian(field, threaded_laplacian, 3);
+  EXAMPLES::computeMeanCurvature(field, curvature);
+  EXAMPLES::computeMeanCurvature(field, threaded_curvature, 3);
+
+  int num_near_surface = 0;
+  for (int k = 0; k < num_cells[2]; ++k)
+    for (int j = 0; j < num_cells[1]; ++j)
+      for (int i = 0; i < num_cells[0]; ++i) {
+        // Same as a plain loop over nodes.
+        for (int axis = 0; axis < 3; ++axis) {
+          int plus[3] = {i, j, k}, minus[3] = {i, j, k};
+          ++plus[axis];
+          --minus[axis];
+          const T expected = -((field(plus[0], plus[1], plus[2]) - field(minus[0], minus[1], minus[2])) /
+                               dx[axis] * static_cast<T>(0.5));
+          EXPECT_NEAR(gradient(i, j, k)[axis], expected, 1e-12);
+        }
+
+        // Same values whatever the number of threads.
+        EXPECT_TRUE(threaded_gradient(i, j, k) == gradient(i, j, k));
+        EXPECT_EQ(threaded_laplacian(i, j, k), laplacian(i, j, k));
+        EXPECT_EQ(threaded_curvature(i, j, k), curvature(i, j, k));
+
+        // Laplacian of a distance field and mean curvature of its iso-surfaces are both 2 / r near the sphere.
+        const T r = (grid(i, j, k) - CENTER).mag();
+        if (std::fabs(r - RADIUS) > 2 * dx[0]) continue;
+        ++num_near_surface;
+        EXPECT_NEAR(laplacian(i, j, k), 2 / r, 0.02 * 2 / r);
+        EXPECT_NEAR(curvature(i, j, k), 2 / r, 0.02 * 2 / r);
+      }
+  EXPECT_GT(num_near_surface, 1000);
+
+  // Stencils read one ghost node around interior nodes.
+  EXAMPLES::Grid<T, 3> unpadded(8, 8, 8);
+  unpadded.setPadding(0);
+  unpadded.generate(0, 1, 0, 1, 0, 1);
+  ScalarArray unpadded_field(unpadded), unpadded_laplacian(unpadded);
+  EXPECT_THROW(EXAMPLES::computeLaplacian(unpadded_field, unpadded_laplacian), std::runtime_error);
+}
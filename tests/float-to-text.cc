@@ -0,0 +1,94 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright 2019 Lakshman Anumolu.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///////////////////////////////////////////////////////////////////////////////
+
+#include "scalar_polygonization/float_to_text.h"
+
+#include <gtest/gtest.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <limits>
+#include <random>
+#include <string>
+
+namespace SP = SCALAR_POLYGONIZATION;
+
+namespace
+{
+std::string text(const float value)
+{
+  char buffer[SP::MAX_FLOAT_TEXT];
+  return std::string(buffer, SP::floatToText(value, buffer));
+}
+}  // namespace
+
+TEST(SCALAR_POLYGONIZATION, FLOAT_TO_TEXT)
+{
+  EXPECT_EQ(text(0.f), "0");
+  EXPECT_EQ(text(-0.f), "-0");
+  EXPECT_EQ(text(1.f), "1");
+  EXPECT_EQ(text(0.1f), "0.1");
+  EXPECT_EQ(text(-2.5f), "-2.5");
+  EXPECT_EQ(text(100.f), "100");
+  EXPECT_EQ(text(123456789.f), "123456790");
+  EXPECT_EQ(text(1e9f), "1e9");
+  EXPECT_EQ(text(1.5e-5f), "0.000015");
+  EXPECT_EQ(text(1e-7f), "1e-7");
+  EXPECT_EQ(text(std::numeric_limits<float>::max()), "3.4028235e38");
+  EXPECT_EQ(text(std::numeric_limits<float>::min()), "1.1754944e-38");
+  EXPECT_EQ(text(std::numeric_limits<float>::denorm_min()), "1e-45");
+  EXPECT_EQ(text(std::numeric_limits<float>::infinity()), "inf");
+  EXPECT_EQ(text(-std::numeric_limits<float>::infinity()), "-inf");
+  EXPECT_EQ(text(std::numeric_limits<float>::quiet_NaN()), "nan");
+
+  // Random bit patterns read back exactly, with as many digits as the shortest printf precision that does.
+  std::mt19937 random(5489u);
+  for (int n = 0; n < 100000; ++n) {
+    const uint32_t bits = random();
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    if (value != value || value - value != 0) continue;
+
+    const std::string shortest = text(value);
+    ASSERT_LE(shortest.size(), SP::MAX_FLOAT_TEXT);
+    const float read = strtof(shortest.c_str(), nullptr);
+    ASSERT_EQ(memcmp(&read, &value, sizeof(value)), 0) << shortest;
+
+    char expected[32];
+    for (int precision = 1; precision <= 9; ++precision) {
+      snprintf(expected, sizeof(expected), "%.*g", precision, static_cast<double>(value));
+      if (strtof(expected, nullptr) == value) break;
+    }
+    ASSERT_EQ(strtod(shortest.c_str(), nullptr), strtod(expected, nullptr)) << shortest << " " << expected;
+  }
+}
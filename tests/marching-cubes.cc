@@ -30,11 +30,14 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include "scalar_polygonization/marching_cubes.h"
+#include "scalar_polygonization/tables.h"
 #include "scalar_polygonization/utilities.h"
 #include "scalar_polygonization/vec3.h"
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <array>
 #include <iostream>
 #include <vector>
 
@@ -69,3 +72,146 @@ TEST(SCALAR_POLYGONIZATION, SCALAR_POLYGONIZATION)
   EXPECT_TRUE(triangles.size() == static_cast<size_t>(2));
   EXPECT_TRUE(vertices.size() == static_cast<size_t>(6));
 }
+
+TEST(SCALAR_POLYGONIZATION, MARCH_CUBE_FIXED_STORAGE)
+{
+  using T = float;
+
+  SCALAR_POLYGONIZATION::MarchingCubes<T> mc;
+
+  const std::array<std::size_t, 8> vertex_ids{0, 1, 2, 3, 4, 5, 6, 7};
+  std::array<std::size_t, 12> edge_ids;
+  mc.vertexToEdgeIds(10, vertex_ids.data(), edge_ids.data());
+
+  const auto edge_ids_ref = std::vector<std::size_t>{0, 12, 3, 11, 4, 16, 7, 15, 22, 23, 24, 25};
+  EXPECT_TRUE(std::equal(edge_ids.begin(), edge_ids.end(), edge_ids_ref.begin()));
+
+  const std::array<SP::Vec3<T>, 8> cube_vertices{SP::Vec3<T>(0, 0, 0), SP::Vec3<T>(1, 0, 0), SP::Vec3<T>(1, 1, 0),
+                                                 SP::Vec3<T>(0, 1, 0), SP::Vec3<T>(0, 0, 1), SP::Vec3<T>(1, 0, 1),
+                                                 SP::Vec3<T>(1, 1, 1), SP::Vec3<T>(0, 1, 1)};
+  const std::array<T, 8> scalars{0, 0, 1, 1, 0, 0, 1, 1};
+  const std::array<SP::Vec3<T>, 8> normals{SP::Vec3<T>(0, 0, 0), SP::Vec3<T>(0, 0, 0), SP::Vec3<T>(0, 1, 0),
+                                           SP::Vec3<T>(0, 1, 0), SP::Vec3<T>(0, 0, 0), SP::Vec3<T>(0, 0, 0),
+                                           SP::Vec3<T>(0, 1, 0), SP::Vec3<T>(0, 1, 0)};
+
+  SP::CubeTriangulation<T> triangulation;
+  EXPECT_EQ(mc.marchCube(cube_vertices, scalars, normals, 0.5, triangulation), 2);
+  EXPECT_EQ(triangulation.num_vertices, 4);
+
+  // Must agree with the allocating overload.
+  const auto triangle_vertex_tuple =
+      mc.marchCube(std::vector<SP::Vec3<T>>(cube_vertices.begin(), cube_vertices.end()),
+                   std::vector<std::size_t>(edge_ids.begin(), edge_ids.end()),
+                   std::vector<T>(scalars.begin(), scalars.end()),
+                   std::vector<SP::Vec3<T>>(normals.begin(), normals.end()), 0.5);
+  const auto vertices = std::get<SCALAR_POLYGONIZATION::VERTICES>(triangle_vertex_tuple);
+
+  for (int corner = 0; corner < 6; ++corner) {
+    const int slot = triangulation.triangles[corner];
+    EXPECT_EQ(edge_ids[triangulation.edges[slot]], vertices[corner].id);
+    EXPECT_TRUE(triangulation.positions[slot] == vertices[corner].pos);
+    EXPECT_TRUE(triangulation.normals[slot] == vertices[corner].normal);
+  }
+
+  // Cube entirely outside of the surface.
+  const std::array<T, 8> outside{1, 1, 1, 1, 1, 1, 1, 1};
+  EXPECT_EQ(mc.marchCube(cube_vertices.data(), outside.data(), nullptr, 0.5, triangulation), 0);
+  EXPECT_EQ(triangulation.num_vertices, 0);
+}
+
+TEST(SCALAR_POLYGONIZATION, MARCH_CUBE_CONVENTIONS)
+{
+  using T = float;
+
+  const SP::MarchingCubes<T, SP::Convention1> mc_1;
+  const SP::MarchingCubes<T, SP::Convention2> mc_2;
+  SP::CubeTriangulation<T> triangulation;
+
+  // Sum of oriented triangle areas and sorted vertex positions, which do not depend on vertex numbering.
+  auto summary = [&](std::array<T, 3>& area) {
+    area = {{0, 0, 0}};
+    for (int t = 0; t < triangulation.num_triangles; ++t) {
+      const auto& p0 = triangulation.positions[triangulation.triangles[3 * t]];
+      const auto e1 = triangulation.positions[triangulation.triangles[3 * t + 1]] - p0;
+      const auto e2 = triangulation.positions[triangulation.triangles[3 * t + 2]] - p0;
+      area[0] += e1[1] * e2[2] - e1[2] * e2[1];
+      area[1] += e1[2] * e2[0] - e1[0] * e2[2];
+      area[2] += e1[0] * e2[1] - e1[1] * e2[0];
+    }
+    std::vector<std::array<T, 3>> positions;
+    for (int v = 0; v < triangulation.num_vertices; ++v) {
+      const auto& position = triangulation.positions[v];
+      positions.push_back({{position[0], position[1], position[2]}});
+    }
+    std::sort(positions.begin(), positions.end());
+    return positions;
+  };
+
+  // Planar fields, whose cases are never ambiguous.
+  const T planes[][4] = {{1, 0.2, -0.3, 0.4}, {-0.3, 1, 0.5, 0.6}, {0.2, 0.1, 1, 0.3}, {-1, -0.7, 0.4, -0.9}};
+  for (const auto& plane : planes) {
+    std::array<SP::Vec3<T>, 8> cube_vertices_1, cube_vertices_2;
+    std::array<T, 8> scalars_1, scalars_2;
+    for (int v = 0; v < 8; ++v) {
+      cube_vertices_1[v] = SP::Vec3<T>(SP::Convention1::vertexOffset(v, 0), SP::Convention1::vertexOffset(v, 1),
+                                       SP::Convention1::vertexOffset(v, 2));
+      cube_vertices_2[v] = SP::Vec3<T>(SP::Convention2::vertexOffset(v, 0), SP::Convention2::vertexOffset(v, 1),
+                                       SP::Convention2::vertexOffset(v, 2));
+      scalars_1[v] = plane[0] * cube_vertices_1[v][0] + plane[1] * cube_vertices_1[v][1] +
+                     plane[2] * cube_vertices_1[v][2] - plane[3];
+      scalars_2[v] = plane[0] * cube_vertices_2[v][0] + plane[1] * cube_vertices_2[v][1] +
+                     plane[2] * cube_vertices_2[v][2] - plane[3];
+    }
+
+    std::array<T, 3> area_1, area_2;
+    ASSERT_GT(mc_1.marchCube(cube_vertices_1.data(), scalars_1.data(), nullptr, 0, triangulation), 0);
+    const auto positions_1 = summary(area_1);
+    ASSERT_GT(mc_2.marchCube(cube_vertices_2.data(), scalars_2.data(), nullptr, 0, triangulation), 0);
+    const auto positions_2 = summary(area_2);
+
+    ASSERT_EQ(positions_1.size(), positions_2.size());
+    for (size_t v = 0; v < positions_1.size(); ++v)
+      for (int axis = 0; axis < 3; ++axis) EXPECT_NEAR(positions_1[v][axis], positions_2[v][axis], 1e-6);
+
+    // Same orientation, towards decreasing scalar values.
+    for (int axis = 0; axis < 3; ++axis) {
+      EXPECT_NEAR(area_1[axis], area_2[axis], 1e-6);
+      EXPECT_LE(area_1[axis] * plane[axis], 0);
+    }
+  }
+
+  const std::vector<std::size_t> vertex_ids{0, 1, 2, 3, 4, 5, 6, 7};
+  const std::vector<std::size_t> edge_ids_ref{0, 23, 3, 22, 4, 27, 7, 26, 11, 12, 13, 14};
+  SP::MarchingCubes<T, SP::Convention2> mc;
+  EXPECT_EQ(mc.vertexToEdgeIds(10, vertex_ids), edge_ids_ref);
+}
+
+TEST(SCALAR_POLYGONIZATION, TRIANGLE_COUNT_TABLE)
+{
+  for (int c = 0; c < 256; ++c) {
+    int num_triangles = 0;
+    while (SP::triangle_table[c][3 * num_triangles] != -1) ++num_triangles;
+    EXPECT_EQ(SP::triangle_count_table[c], num_triangles);
+  }
+}
+
+TEST(SCALAR_POLYGONIZATION, CASE_TABLES)
+{
+  for (int c = 0; c < 256; ++c) {
+    const int num_edges = SP::case_edge_count[c];
+    int intersected_edges = 0;
+    for (int n = 0; n < num_edges; ++n) {
+      if (n > 0) {
+        EXPECT_LT(SP::case_edges[c][n - 1], SP::case_edges[c][n]);
+      }
+      intersected_edges |= 1 << SP::case_edges[c][n];
+    }
+    EXPECT_EQ(intersected_edges, SP::edge_table[c]);
+
+    for (int i = 0; i < 3 * static_cast<int>(SP::triangle_count_table[c]); ++i) {
+      const int slot = SP::case_triangles[c][i];
+      ASSERT_LT(slot, num_edges);
+      EXPECT_EQ(static_cast<int>(SP::case_edges[c][slot]), SP::triangle_table[c][i]);
+    }
+  }
+}
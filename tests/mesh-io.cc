@@ -0,0 +1,227 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright 2019 Lakshman Anumolu.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///////////////////////////////////////////////////////////////////////////////
+
+#include "scalar_polygonization/mesh_io.h"
+#include "scalar_polygonization/polygonize_volume.h"
+#include "scalar_polygonization/vec3.h"
+#include "test_utilities.h"
+
+#include <gtest/gtest.h>
+
+#include <string.h>
+
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace SP = SCALAR_POLYGONIZATION;
+namespace SPT = SCALAR_POLYGONIZATION_TESTS;
+
+namespace
+{
+using T = float;
+
+//! Sphere with vertex normals in a volume of `n^3` nodes.
+SP::IndexedMesh<T> sphereMesh(const int n = 11)
+{
+  const SP::Vec3<int> dims(n, n, n);
+  const T dx = static_cast<T>(2.) / (n - 1);
+  const auto field = SPT::sphereField<T>(dims, 0.85);
+  const SP::ScalarVolume<T> volume(field.data(), dims, SP::Vec3<T>(-1, -1, -1), SP::Vec3<T>(dx, dx, dx));
+  auto mesh = SP::polygonizeVolume(volume, static_cast<T>(0.));
+  SP::computeVertexNormals(mesh);
+  return mesh;
+}
+
+std::string readFile(const std::string& path)
+{
+  std::ifstream file(path, std::ios::binary);
+  return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+//! Unsigned integer of type U stored least significant byte first at `offset`.
+template <typename U>
+U loadLittleEndian(const std::string& bytes, const size_t offset)
+{
+  U value = 0;
+  for (size_t n = 0; n < sizeof(U); ++n) value |= static_cast<U>(static_cast<uint8_t>(bytes[offset + n])) << (8 * n);
+  return value;
+}
+
+//! Floating point value of type F stored least significant byte first at `offset`.
+template <typename F, typename U>
+F loadLittleEndianFloat(const std::string& bytes, const size_t offset)
+{
+  static_assert(sizeof(F) == sizeof(U), "same size");
+  const U bits = loadLittleEndian<U>(bytes, offset);
+  F value;
+  memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+}  // namespace
+
+TEST(SCALAR_POLYGONIZATION, MESH_IO_PLY)
+{
+  const auto mesh = sphereMesh();
+  ASSERT_GT(mesh.numTriangles(), 0u);
+
+  const std::string path = ::testing::TempDir() + "sp_mesh_io.ply";
+  SP::writePly(path, mesh);
+  const std::string bytes = readFile(path);
+
+  const std::string end_header = "end_header\n";
+  const size_t body = bytes.find(end_header) + end_header.size();
+  const std::string header = bytes.substr(0, body);
+  EXPECT_EQ(header.find("ply\nformat binary_little_endian 1.0\n"), 0u);
+  EXPECT_NE(header.find("element vertex " + std::to_string(mesh.numVertices()) + "\n"), std::string::npos);
+  EXPECT_NE(header.find("property float nz\n"), std::string::npos);
+  EXPECT_NE(header.find("element face " + std::to_string(mesh.numTriangles()) + "\n"), std::string::npos);
+  ASSERT_EQ(bytes.size(), body + mesh.numVertices() * 6 * sizeof(T) + mesh.numTriangles() * 13);
+
+  // Little endian whatever the host.
+  for (size_t v = 0; v < mesh.numVertices(); ++v)
+    for (int axis = 0; axis < 3; ++axis) {
+      const size_t record = body + v * 6 * sizeof(T);
+      EXPECT_EQ((loadLittleEndianFloat<T, uint32_t>(bytes, record + axis * sizeof(T))), mesh.positions[v][axis]);
+      EXPECT_EQ((loadLittleEndianFloat<T, uint32_t>(bytes, record + (3 + axis) * sizeof(T))), mesh.normals[v][axis]);
+    }
+  const size_t faces = body + mesh.numVertices() * 6 * sizeof(T);
+  for (size_t t = 0; t < mesh.numTriangles(); ++t) {
+    EXPECT_EQ(bytes[faces + 13 * t], 3);
+    for (int c = 0; c < 3; ++c)
+      EXPECT_EQ(loadLittleEndian<uint32_t>(bytes, faces + 13 * t + 1 + 4 * c), mesh.indices[3 * t + c]);
+  }
+
+  // Double positions without normals.
+  SP::IndexedMesh<double> mesh_double;
+  for (const auto& position : mesh.positions) mesh_double.positions.push_back(SP::Vec3<double>(position[0] / 3, 0, 0));
+  mesh_double.indices = mesh.indices;
+  SP::writePly(path, mesh_double);
+  const std::string bytes_double = readFile(path);
+  const size_t body_double = bytes_double.find(end_header) + end_header.size();
+  EXPECT_NE(bytes_double.substr(0, body_double).find("property double x\n"), std::string::npos);
+  ASSERT_EQ(bytes_double.size(), body_double + mesh.numVertices() * 3 * sizeof(double) + mesh.numTriangles() * 13);
+  for (size_t v = 0; v < mesh.numVertices(); ++v)
+    EXPECT_EQ((loadLittleEndianFloat<double, uint64_t>(bytes_double, body_double + v * 3 * sizeof(double))),
+              mesh_double.positions[v][0]);
+
+  EXPECT_THROW(SP::writePly(::testing::TempDir() + "missing/sp_mesh_io.ply", mesh), std::runtime_error);
+}
+
+TEST(SCALAR_POLYGONIZATION, MESH_IO_STL)
+{
+  const auto mesh = sphereMesh();
+
+  const std::string path = ::testing::TempDir() + "sp_mesh_io.stl";
+  SP::writeStl(path, mesh);
+  const std::string bytes = readFile(path);
+  ASSERT_EQ(bytes.size(), 84 + 50 * mesh.numTriangles());
+
+  // Little endian whatever the host.
+  EXPECT_EQ(loadLittleEndian<uint32_t>(bytes, 80), mesh.numTriangles());
+
+  for (size_t t = 0; t < mesh.numTriangles(); ++t) {
+    float values[12];
+    memcpy(values, &bytes[84 + 50 * t], sizeof(values));
+    const SP::Vec3<T> normal(values[0], values[1], values[2]);
+    EXPECT_NEAR(normal.mag(), 1, 1e-5);
+    for (int c = 0; c < 3; ++c)
+      for (int axis = 0; axis < 3; ++axis)
+        EXPECT_EQ(values[3 + 3 * c + axis], mesh.positions[mesh.indices[3 * t + c]][axis]);
+
+    // Facet normals follow the winding, on the same side as vertex normals.
+    const auto agreement = normal * mesh.normals[mesh.indices[3 * t]];
+    EXPECT_GT(agreement[0] + agreement[1] + agreement[2], 0);
+  }
+}
+
+TEST(SCALAR_POLYGONIZATION, MESH_IO_OBJ)
+{
+  // Enough lines for several chunks formatted in parallel.
+  const auto mesh = sphereMesh(61);
+  ASSERT_GT(mesh.numVertices(), 10000u);
+
+  const std::string path = ::testing::TempDir() + "sp_mesh_io.obj";
+  SP::writeObj(path, mesh, 3);
+
+  std::istringstream lines(readFile(path));
+  std::string line;
+  SP::IndexedMesh<T> read;
+  while (std::getline(lines, line)) {
+    std::istringstream fields(line);
+    std::string kind;
+    fields >> kind;
+    if (kind == "v" || kind == "vn") {
+      T x, y, z;
+      fields >> x >> y >> z;
+      (kind == "v" ? read.positions : read.normals).emplace_back(x, y, z);
+    } else if (kind == "f") {
+      for (int c = 0; c < 3; ++c) {
+        std::string corner;
+        fields >> corner;
+        const size_t slashes = corner.find("//");
+        ASSERT_NE(slashes, std::string::npos);
+        EXPECT_EQ(corner.substr(0, slashes), corner.substr(slashes + 2));
+        read.indices.push_back(static_cast<uint32_t>(std::stoul(corner) - 1));
+      }
+    }
+  }
+
+  // Positions and normals read back exactly.
+  EXPECT_TRUE(read.positions == mesh.positions);
+  EXPECT_TRUE(read.normals == mesh.normals);
+  EXPECT_EQ(read.indices, mesh.indices);
+
+  EXPECT_THROW(SP::writeObj(::testing::TempDir() + "missing/sp_mesh_io.obj", mesh), std::runtime_error);
+}
+
+TEST(SCALAR_POLYGONIZATION, MESH_IO_64_BIT_INDICES)
+{
+  const auto mesh = sphereMesh();
+
+  SP::IndexedMesh<T, uint64_t> wide_mesh;
+  wide_mesh.positions = mesh.positions;
+  wide_mesh.indices.assign(mesh.indices.begin(), mesh.indices.end());
+  SP::computeVertexNormals(wide_mesh);
+  EXPECT_TRUE(wide_mesh.normals == mesh.normals);
+
+  // Same files as with 32 bit indices.
+  const std::string path = ::testing::TempDir() + "sp_mesh_io", wide_path = path + "_64";
+  SP::writeObj(path + ".obj", mesh);
+  SP::writeObj(wide_path + ".obj", wide_mesh);
+  EXPECT_EQ(readFile(wide_path + ".obj"), readFile(path + ".obj"));
+  SP::writePly(path + ".ply", mesh);
+  SP::writePly(wide_path + ".ply", wide_mesh);
+  EXPECT_EQ(readFile(wide_path + ".ply"), readFile(path + ".ply"));
+}
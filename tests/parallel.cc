@@ -0,0 +1,92 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright 2019 Lakshman Anumolu.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include "scalar_polygonization/parallel.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <map>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace SP = SCALAR_POLYGONIZATION;
+
+TEST(SCALAR_POLYGONIZATION, PARALLEL_FOR)
+{
+  for (const unsigned num_threads : {1u, 4u}) {
+    std::vector<int> runs(100, 0);
+    SP::parallelFor(runs.size(), num_threads, [&](const size_t i) { ++runs[i]; });
+    EXPECT_EQ(runs, std::vector<int>(100, 1));
+
+    // A throwing task stops handing out tasks and its exception reaches the caller.
+    std::atomic<size_t> num_runs(0);
+    EXPECT_THROW(SP::parallelFor(1000, num_threads,
+                                 [&](const size_t i) {
+                                   ++num_runs;
+                                   if (i == 10) throw std::overflow_error("task 10");
+                                 }),
+                 std::overflow_error);
+    EXPECT_LT(num_runs.load(), 1000u);
+  }
+}
+
+TEST(SCALAR_POLYGONIZATION, PARALLEL_FOR_STATIC)
+{
+  EXPECT_EQ(SP::numSlabs(100, 1), 1u);
+  EXPECT_EQ(SP::numSlabs(100, 3), 12u);
+  EXPECT_EQ(SP::numSlabs(5, 3), 5u);
+  EXPECT_EQ(SP::numSlabs(0, 3), 1u);
+  EXPECT_EQ(SP::slabBegin(10, 4, 0), 0u);
+  EXPECT_EQ(SP::slabBegin(10, 4, 4), 10u);
+
+  // Each thread runs a contiguous range of tasks, the calling thread the first one.
+  const size_t num_tasks = 20;
+  std::vector<std::thread::id> runner(num_tasks);
+  SP::parallelForStatic(num_tasks, 4, [&](const size_t i) { runner[i] = std::this_thread::get_id(); });
+  EXPECT_EQ(runner[0], std::this_thread::get_id());
+  std::map<std::thread::id, std::vector<size_t>> tasks;
+  for (size_t i = 0; i < num_tasks; ++i) tasks[runner[i]].push_back(i);
+  EXPECT_EQ(tasks.size(), 4u);
+  for (const auto& thread_tasks : tasks) {
+    EXPECT_EQ(thread_tasks.second.size(), 5u);
+    EXPECT_EQ(thread_tasks.second.back() - thread_tasks.second.front(), 4u);
+    EXPECT_EQ(thread_tasks.second.front() % 5, 0u);
+  }
+
+  EXPECT_THROW(SP::parallelForStatic(num_tasks, 4,
+                                     [](const size_t i) {
+                                       if (i == 7) throw std::runtime_error("task 7");
+                                     }),
+               std::runtime_error);
+}
@@ -0,0 +1,126 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright 2019 Lakshman Anumolu.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///////////////////////////////////////////////////////////////////////////////
+
+#include "scalar_polygonization/polygonize_function.h"
+#include "scalar_polygonization/polygonize_volume.h"
+#include "scalar_polygonization/vec3.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace SP = SCALAR_POLYGONIZATION;
+
+namespace
+{
+using T = float;
+
+//! Two overlapping spheres, the union of which is below zero.
+T spheres(const T x, const T y, const T z)
+{
+  const T d1 = x * x + y * y + (z - 0.3f) * (z - 0.3f) - 0.25f;
+  const T d2 = (x - 0.2f) * (x - 0.2f) + y * y + (z + 0.4f) * (z + 0.4f) - 0.16f;
+  return std::min(d1, d2);
+}
+}  // namespace
+
+TEST(SCALAR_POLYGONIZATION, POLYGONIZE_FUNCTION)
+{
+  const SP::Vec3<int> dims(21, 17, 33);
+  const SP::Vec3<T> origin(-1, -0.8, -1.2), spacing(0.1, 0.1, 0.075);
+
+  // Same values as the function samples, stored as a volume.
+  std::vector<T> field;
+  for (int k = 0; k < dims[2]; ++k)
+    for (int j = 0; j < dims[1]; ++j)
+      for (int i = 0; i < dims[0]; ++i)
+        field.push_back(spheres(origin[0] + i * spacing[0], origin[1] + j * spacing[1], origin[2] + k * spacing[2]));
+  const SP::ScalarVolume<T> volume(field.data(), dims, origin, spacing);
+
+  for (const auto extraction :
+       {SP::PolygonizeOptions::Extraction::SINGLE_PASS, SP::PolygonizeOptions::Extraction::COUNT_THEN_FILL})
+    for (const unsigned num_threads : {1u, 3u}) {
+      SP::PolygonizeOptions options;
+      options.num_threads = num_threads;
+      options.extraction = extraction;
+
+      const auto expected = SP::polygonizeVolume(volume, static_cast<T>(0.), options);
+      const auto mesh = SP::polygonizeFunction(spheres, dims, origin, spacing, static_cast<T>(0.), options);
+
+      EXPECT_GT(mesh.numTriangles(), 0u);
+      EXPECT_EQ(mesh.indices, expected.indices);
+      ASSERT_EQ(mesh.numVertices(), expected.numVertices());
+      for (size_t v = 0; v < mesh.numVertices(); ++v) {
+        EXPECT_TRUE(mesh.positions[v] == expected.positions[v]);
+        EXPECT_TRUE(mesh.normals[v] == expected.normals[v]);
+      }
+    }
+
+  // A single slab samples every node plane once, in increasing order.
+  std::vector<int> sampled;
+  const SP::PlaneSampler<T> sample_plane = [&](const int k, T* values) {
+    const size_t plane_size = static_cast<size_t>(dims[0]) * dims[1];
+    sampled.push_back(k);
+    std::copy(&field[k * plane_size], &field[(k + 1) * plane_size], values);
+  };
+  const auto mesh = SP::polygonizePlanes(sample_plane, dims, origin, spacing, static_cast<T>(0.));
+  EXPECT_EQ(mesh.indices, SP::polygonizeVolume(volume, static_cast<T>(0.)).indices);
+  ASSERT_EQ(sampled.size(), static_cast<size_t>(dims[2]));
+  for (int k = 0; k < dims[2]; ++k) EXPECT_EQ(sampled[k], k);
+}
+
+TEST(SCALAR_POLYGONIZATION, POLYGONIZE_FUNCTION_GRADIENT)
+{
+  const int n = 24;
+  const T radius = 0.6, dx = static_cast<T>(2.) / (n - 1);
+  const auto sphere = [radius](const T x, const T y, const T z) { return x * x + y * y + z * z - radius * radius; };
+  const auto gradient = [](const T x, const T y, const T z) { return SP::Vec3<T>(2 * x, 2 * y, 2 * z); };
+
+  const auto mesh = SP::polygonizeFunction(sphere, gradient, SP::Vec3<int>(n, n, n), SP::Vec3<T>(-1, -1, -1),
+                                           SP::Vec3<T>(dx, dx, dx), static_cast<T>(0.));
+
+  ASSERT_GT(mesh.numVertices(), 0u);
+  ASSERT_EQ(mesh.normals.size(), mesh.numVertices());
+  for (size_t v = 0; v < mesh.numVertices(); ++v) {
+    auto inward = mesh.positions[v] * static_cast<T>(-1.);
+    inward.normalize();
+    for (int axis = 0; axis < 3; ++axis) EXPECT_NEAR(mesh.normals[v][axis], inward[axis], 1e-5);
+  }
+
+  // Without normals from triangles, the mesh is otherwise the same.
+  SP::PolygonizeOptions options;
+  options.normal_weighting = SP::NormalWeighting::NONE;
+  const auto without_normals = SP::polygonizeFunction(sphere, SP::Vec3<int>(n, n, n), SP::Vec3<T>(-1, -1, -1),
+                                                      SP::Vec3<T>(dx, dx, dx), static_cast<T>(0.), options);
+  EXPECT_TRUE(without_normals.normals.empty());
+  EXPECT_EQ(without_normals.indices, mesh.indices);
+}
@@ -0,0 +1,86 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright 2019 Lakshman Anumolu.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///////////////////////////////////////////////////////////////////////////////
+
+#include "scalar_polygonization/polygonize_stream.h"
+#include "scalar_polygonization/polygonize_volume.h"
+#include "scalar_polygonization/vec3.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace SP = SCALAR_POLYGONIZATION;
+
+TEST(SCALAR_POLYGONIZATION, POLYGONIZE_STREAM)
+{
+  using T = float;
+
+  const SP::Vec3<int> dims(19, 23, 31);
+  const SP::Vec3<T> origin(-1, -1, -1), spacing(0.1, 0.1, 0.08);
+  const size_t plane_size = static_cast<size_t>(dims[0]) * dims[1];
+
+  // Ellipsoid clipped by the bottom of the volume.
+  std::vector<T> field;
+  for (int k = 0; k < dims[2]; ++k)
+    for (int j = 0; j < dims[1]; ++j)
+      for (int i = 0; i < dims[0]; ++i) {
+        const T x = origin[0] + i * spacing[0], y = origin[1] + j * spacing[1], z = origin[2] + k * spacing[2];
+        field.push_back(x * x + 2 * y * y + (z + 0.5f) * (z + 0.5f) - 0.5f);
+      }
+  const SP::ScalarVolume<T> volume(field.data(), dims, origin, spacing);
+  const auto expected = SP::polygonizeVolume(volume, static_cast<T>(0.));
+
+  int next_plane = 0;
+  const SP::PlaneSampler<T> read_plane = [&](const int k, T* values) {
+    EXPECT_EQ(k, next_plane++);
+    std::copy(&field[k * plane_size], &field[(k + 1) * plane_size], values);
+  };
+
+  SP::IndexedMesh<T, uint64_t> mesh;
+  size_t max_layer_vertices = 0;
+  const SP::MeshSink<T> sink = [&](const std::vector<SP::Vec3<T>>& positions, const std::vector<uint64_t>& indices) {
+    max_layer_vertices = std::max(max_layer_vertices, positions.size());
+    mesh.positions.insert(mesh.positions.end(), positions.begin(), positions.end());
+    for (const uint64_t vertex : indices) EXPECT_LT(vertex, mesh.numVertices());
+    mesh.indices.insert(mesh.indices.end(), indices.begin(), indices.end());
+  };
+
+  SP::polygonizeStream(read_plane, dims, origin, spacing, static_cast<T>(0.), sink);
+
+  EXPECT_EQ(next_plane, dims[2]);
+  EXPECT_GT(mesh.numTriangles(), 0u);
+  EXPECT_LT(max_layer_vertices, mesh.numVertices());
+  ASSERT_EQ(mesh.indices.size(), expected.indices.size());
+  EXPECT_TRUE(std::equal(mesh.indices.begin(), mesh.indices.end(), expected.indices.begin()));
+  ASSERT_EQ(mesh.numVertices(), expected.numVertices());
+  for (size_t v = 0; v < mesh.numVertices(); ++v) EXPECT_TRUE(mesh.positions[v] == expected.positions[v]);
+}
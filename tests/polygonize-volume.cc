@@ -0,0 +1,340 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright 2019 Lakshman Anumolu.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///////////////////////////////////////////////////////////////////////////////
+
+#include "scalar_polygonization/polygonize_volume.h"
+#include "scalar_polygonization/utilities.h"
+#include "scalar_polygonization/vec3.h"
+#include "test_utilities.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace SP = SCALAR_POLYGONIZATION;
+namespace SPT = SCALAR_POLYGONIZATION_TESTS;
+
+namespace
+{
+using T = float;
+
+//! Number of triangles sharing each undirected edge.
+std::map<std::pair<uint32_t, uint32_t>, int> edgeValence(const SP::IndexedMesh<T>& mesh)
+{
+  std::map<std::pair<uint32_t, uint32_t>, int> valence;
+  for (size_t t = 0; t < mesh.numTriangles(); ++t)
+    for (int c = 0; c < 3; ++c) {
+      const auto a = mesh.indices[3 * t + c], b = mesh.indices[3 * t + (c + 1) % 3];
+      ++valence[std::make_pair(std::min(a, b), std::max(a, b))];
+    }
+  return valence;
+}
+}  // namespace
+
+TEST(SCALAR_POLYGONIZATION, POLYGONIZE_VOLUME_SPHERE)
+{
+  const int n = 24;
+  const T radius = 0.6;
+  const T dx = static_cast<T>(2.) / (n - 1);
+  const auto field = SPT::sphereField<T>(SP::Vec3<int>(n, n, n), radius);
+
+  const SP::ScalarVolume<T> volume(field.data(), SP::Vec3<int>(n, n, n), SP::Vec3<T>(-1, -1, -1),
+                                   SP::Vec3<T>(dx, dx, dx));
+  const auto mesh = SP::polygonizeVolume(volume, static_cast<T>(0.));
+
+  EXPECT_GT(mesh.numTriangles(), static_cast<size_t>(0));
+  EXPECT_EQ(mesh.normals.size(), mesh.numVertices());
+
+  // Closed, genus zero surface.
+  const auto valence = edgeValence(mesh);
+  for (const auto& edge : valence) EXPECT_EQ(edge.second, 2);
+  EXPECT_EQ(static_cast<long>(mesh.numVertices()) - static_cast<long>(valence.size()) +
+                static_cast<long>(mesh.numTriangles()),
+            2);
+
+  // Vertices lie on the sphere, normals follow triangle winding which points towards decreasing scalar.
+  for (size_t v = 0; v < mesh.numVertices(); ++v) {
+    const auto& p = mesh.positions[v];
+    const auto& normal = mesh.normals[v];
+    EXPECT_NEAR(p.mag(), radius, dx);
+    EXPECT_NEAR(normal.mag(), 1., 1e-5);
+    EXPECT_LT(p[0] * normal[0] + p[1] * normal[1] + p[2] * normal[2], 0.);
+  }
+}
+
+TEST(SCALAR_POLYGONIZATION, POLYGONIZE_VOLUME_STRIDED)
+{
+  const int n = 16, ghost = 2, n_ghost = n + 2 * ghost;
+  const T radius = 0.5;
+  const T dx = static_cast<T>(2.) / (n - 1);
+  const auto field = SPT::sphereField<T>(SP::Vec3<int>(n, n, n), radius);
+
+  // Same field stored with ghost layers and interleaved with a second component.
+  std::vector<T> solver_field(2 * n_ghost * n_ghost * n_ghost, static_cast<T>(-1.));
+  for (int k = 0; k < n; ++k)
+    for (int j = 0; j < n; ++j)
+      for (int i = 0; i < n; ++i)
+        solver_field[2 * ((k + ghost) * n_ghost * n_ghost + (j + ghost) * n_ghost + (i + ghost))] =
+            field[(k * n + j) * n + i];
+
+  const SP::Vec3<int> dims(n, n, n);
+  const SP::Vec3<T> origin(-1, -1, -1), spacing(dx, dx, dx);
+  const SP::ScalarVolume<T> contiguous(field.data(), dims, origin, spacing);
+  const SP::ScalarVolume<T> strided(solver_field.data(), dims,
+                                    SP::Vec3<size_t>(2, 2 * n_ghost, 2 * n_ghost * n_ghost), ghost, origin, spacing);
+
+  EXPECT_EQ(strided(3, 4, 5), contiguous(3, 4, 5));
+
+  const auto mesh = SP::polygonizeVolume(contiguous, static_cast<T>(0.));
+  const auto strided_mesh = SP::polygonizeVolume(strided, static_cast<T>(0.));
+
+  SPT::expectIdenticalMeshes(strided_mesh, mesh);
+}
+
+TEST(SCALAR_POLYGONIZATION, POLYGONIZE_VOLUME_THREADS)
+{
+  const SP::Vec3<int> dims(23, 19, 41);
+  const T dx = static_cast<T>(2.) / 22;
+
+  // Two overlapping spheres, so that the surface crosses many slab boundaries.
+  std::vector<T> field;
+  for (int k = 0; k < dims[2]; ++k)
+    for (int j = 0; j < dims[1]; ++j)
+      for (int i = 0; i < dims[0]; ++i) {
+        const T x = -1 + i * dx, y = -1 + j * dx, z = -1 + k * dx;
+        const T d1 = x * x + y * y + (z - 0.4) * (z - 0.4) - 0.25;
+        const T d2 = (x - 0.2) * (x - 0.2) + y * y + (z - 1.2) * (z - 1.2) - 0.25;
+        field.push_back(std::min(d1, d2));
+      }
+
+  const SP::ScalarVolume<T> volume(field.data(), dims, SP::Vec3<T>(-1, -1, -1), SP::Vec3<T>(dx, dx, dx));
+  const auto serial = SP::polygonizeVolume(volume, static_cast<T>(0.));
+
+  const auto valence = edgeValence(serial);
+  for (const auto& edge : valence) EXPECT_EQ(edge.second, 2);
+
+  for (const unsigned num_threads : {2u, 3u, 8u, 0u}) {
+    SP::PolygonizeOptions options;
+    options.num_threads = num_threads;
+    const auto parallel = SP::polygonizeVolume(volume, static_cast<T>(0.), options);
+
+    SPT::expectIdenticalMeshes(parallel, serial);
+  }
+}
+
+TEST(SCALAR_POLYGONIZATION, POLYGONIZE_VOLUME_COUNT_THEN_FILL)
+{
+  const int n = 37;
+  const T dx = static_cast<T>(2.) / (n - 1);
+
+  // Closed surface, and surface clipped by all faces of the volume.
+  for (const T radius : {0.6, 1.2}) {
+    const auto field = SPT::sphereField<T>(SP::Vec3<int>(n, n, n), radius);
+    const SP::ScalarVolume<T> volume(field.data(), SP::Vec3<int>(n, n, n), SP::Vec3<T>(-1, -1, -1),
+                                     SP::Vec3<T>(dx, dx, dx));
+    const auto single_pass = SP::polygonizeVolume(volume, static_cast<T>(0.));
+
+    for (const unsigned num_threads : {1u, 2u, 5u, 0u}) {
+      SP::PolygonizeOptions options;
+      options.num_threads = num_threads;
+      options.extraction = SP::PolygonizeOptions::Extraction::COUNT_THEN_FILL;
+      const auto mesh = SP::polygonizeVolume(volume, static_cast<T>(0.), options);
+
+      SPT::expectIdenticalMeshes(mesh, single_pass);
+      EXPECT_EQ(mesh.positions.capacity(), mesh.numVertices());
+    }
+  }
+}
+
+TEST(SCALAR_POLYGONIZATION, POLYGONIZE_VOLUME_MULTIPLE_ISO_VALUES)
+{
+  const int n = 33;
+  const auto field = SPT::sphereField<T>(SP::Vec3<int>(n, n, n), 0.);
+  const T dx = static_cast<T>(2.) / (n - 1);
+  const SP::ScalarVolume<T> volume(field.data(), SP::Vec3<int>(n, n, n), SP::Vec3<T>(-1, -1, -1),
+                                   SP::Vec3<T>(dx, dx, dx));
+
+  // Nested spheres, one clipped by the volume, and an empty surface.
+  const std::vector<T> iso_alphas = {0.1, 0.5, 1.5, 0.5, 4.};
+
+  for (const auto extraction :
+       {SP::PolygonizeOptions::Extraction::SINGLE_PASS, SP::PolygonizeOptions::Extraction::COUNT_THEN_FILL})
+    for (const unsigned num_threads : {1u, 3u}) {
+      SP::PolygonizeOptions options;
+      options.num_threads = num_threads;
+      options.extraction = extraction;
+      const auto meshes = SP::polygonizeVolume(volume, iso_alphas, options);
+
+      ASSERT_EQ(meshes.size(), iso_alphas.size());
+      for (size_t m = 0; m < iso_alphas.size(); ++m) {
+        const auto mesh = SP::polygonizeVolume(volume, iso_alphas[m], options);
+        SPT::expectIdenticalMeshes(meshes[m], mesh);
+      }
+      EXPECT_EQ(meshes.back().numTriangles(), 0u);
+    }
+
+  EXPECT_TRUE(SP::polygonizeVolume(volume, std::vector<T>()).empty());
+}
+
+TEST(SCALAR_POLYGONIZATION, POLYGONIZE_VOLUME_QUANTIZED)
+{
+  const int n = 29;
+  const auto field = SPT::sphereField<T>(SP::Vec3<int>(n, n, n), 0.);
+  const T dx = static_cast<T>(2.) / (n - 1);
+  const SP::Vec3<int> dims(n, n, n);
+  const SP::Vec3<T> origin(-1, -1, -1), spacing(dx, dx, dx);
+
+  // Field quantized to 16 and 8 bits, and the same quantized values stored as float.
+  std::vector<uint16_t> field_16;
+  std::vector<uint8_t> field_8;
+  std::vector<T> dequantized_16, dequantized_8;
+  for (const T value : field) {
+    field_16.push_back(static_cast<uint16_t>(value * 20000 + 0.5));
+    field_8.push_back(static_cast<uint8_t>(value * 80 + 0.5));
+    dequantized_16.push_back(field_16.back());
+    dequantized_8.push_back(field_8.back());
+  }
+
+  const SP::ScalarVolume<T, uint16_t> volume_16(field_16.data(), dims, origin, spacing);
+  const SP::ScalarVolume<T, uint8_t> volume_8(field_8.data(), dims, origin, spacing);
+  const SP::ScalarVolume<T> reference_16(dequantized_16.data(), dims, origin, spacing);
+  const SP::ScalarVolume<T> reference_8(dequantized_8.data(), dims, origin, spacing);
+
+  // Iso-values between and on quantization levels, and beyond the range of the storage type.
+  SP::PolygonizeOptions options;
+  options.num_threads = 2;
+  for (const T iso_alpha : {-1.f, 0.f, 20.f, 20.5f, 100.f, 250.f, 300.f, 5000.25f, 7e4f}) {
+    const auto mesh_16 = SP::polygonizeVolume(volume_16, iso_alpha, options);
+    const auto mesh_8 = SP::polygonizeVolume(volume_8, iso_alpha, options);
+    const auto expected_16 = SP::polygonizeVolume(reference_16, iso_alpha, options);
+    const auto expected_8 = SP::polygonizeVolume(reference_8, iso_alpha, options);
+
+    EXPECT_EQ(mesh_16.indices, expected_16.indices);
+    EXPECT_TRUE(mesh_16.positions == expected_16.positions);
+    EXPECT_EQ(mesh_8.indices, expected_8.indices);
+    EXPECT_TRUE(mesh_8.positions == expected_8.positions);
+  }
+
+#if defined(SP_HAS_FLOAT16)
+  std::vector<_Float16> field_half;
+  std::vector<T> dequantized_half;
+  for (const T value : field) {
+    field_half.push_back(static_cast<_Float16>(value));
+    dequantized_half.push_back(field_half.back());
+  }
+  const SP::ScalarVolume<T, _Float16> volume_half(field_half.data(), dims, origin, spacing);
+  const SP::ScalarVolume<T> reference_half(dequantized_half.data(), dims, origin, spacing);
+
+  for (const T iso_alpha : {0.1f, 0.5f, 0.50001f, 1.5f}) {
+    const auto mesh = SP::polygonizeVolume(volume_half, iso_alpha);
+    const auto expected = SP::polygonizeVolume(reference_half, iso_alpha);
+    EXPECT_GT(expected.numTriangles(), 0u);
+    EXPECT_EQ(mesh.indices, expected.indices);
+    EXPECT_TRUE(mesh.positions == expected.positions);
+  }
+#endif
+}
+
+TEST(SCALAR_POLYGONIZATION, POLYGONIZE_VOLUME_DOUBLE)
+{
+  const int n = 24;
+  const auto field = SPT::sphereField<T>(SP::Vec3<int>(n, n, n), 0.6);
+  const std::vector<double> field_double(field.begin(), field.end());
+  const double dx = 2. / (n - 1);
+
+  const SP::ScalarVolume<T> volume(field.data(), SP::Vec3<int>(n, n, n), SP::Vec3<T>(-1, -1, -1),
+                                   SP::Vec3<T>(dx, dx, dx));
+  const SP::ScalarVolume<double> volume_double(field_double.data(), SP::Vec3<int>(n, n, n),
+                                               SP::Vec3<double>(-1, -1, -1), SP::Vec3<double>(dx, dx, dx));
+
+  const auto mesh = SP::polygonizeVolume(volume, static_cast<T>(0.));
+  const auto mesh_double = SP::polygonizeVolume(volume_double, 0.);
+
+  EXPECT_EQ(mesh.indices, mesh_double.indices);
+  ASSERT_EQ(mesh.numVertices(), mesh_double.numVertices());
+  for (size_t v = 0; v < mesh.numVertices(); ++v)
+    for (int axis = 0; axis < 3; ++axis) EXPECT_NEAR(mesh.positions[v][axis], mesh_double.positions[v][axis], 1e-5);
+}
+
+TEST(SCALAR_POLYGONIZATION, VERTEX_NORMALS)
+{
+  // Enough triangles for several chunks.
+  const int n = 80;
+  const auto field = SPT::sphereField<T>(SP::Vec3<int>(n, n, n), 0.7);
+  const T dx = static_cast<T>(2.) / (n - 1);
+  const SP::ScalarVolume<T> volume(field.data(), SP::Vec3<int>(n, n, n), SP::Vec3<T>(-1, -1, -1),
+                                   SP::Vec3<T>(dx, dx, dx));
+  auto mesh = SP::polygonizeVolume(volume, static_cast<T>(0.));
+  ASSERT_GT(mesh.numTriangles(), 20000u);
+
+  for (const auto weighting : {SP::NormalWeighting::AREA, SP::NormalWeighting::ANGLE}) {
+    // Serial scatter of weighted triangle normals.
+    std::vector<SP::Vec3<double>> expected(mesh.numVertices(), SP::Vec3<double>(0, 0, 0));
+    for (size_t t = 0; t < mesh.numTriangles(); ++t)
+      for (int c = 0; c < 3; ++c) {
+        const auto& p = mesh.positions[mesh.indices[3 * t + c]];
+        const auto& q = mesh.positions[mesh.indices[3 * t + (c + 1) % 3]];
+        const auto& r = mesh.positions[mesh.indices[3 * t + (c + 2) % 3]];
+        const SP::Vec3<double> u(q[0] - p[0], q[1] - p[1], q[2] - p[2]), w(r[0] - p[0], r[1] - p[1], r[2] - p[2]);
+        const SP::Vec3<double> cross(u[1] * w[2] - u[2] * w[1], u[2] * w[0] - u[0] * w[2], u[0] * w[1] - u[1] * w[0]);
+        const double weight = weighting == SP::NormalWeighting::AREA
+                                  ? 1.
+                                  : std::acos((u[0] * w[0] + u[1] * w[1] + u[2] * w[2]) / (u.mag() * w.mag())) /
+                                        cross.mag();
+        auto& normal = expected[mesh.indices[3 * t + c]];
+        normal = normal + cross * weight;
+      }
+
+    SP::computeVertexNormals(mesh, weighting, 1);
+    const auto serial = mesh.normals;
+    SP::computeVertexNormals(mesh, weighting, 4);
+    for (size_t v = 0; v < mesh.numVertices(); ++v) {
+      EXPECT_TRUE(mesh.normals[v] == serial[v]);
+      auto normal = expected[v];
+      normal.normalize();
+      for (int axis = 0; axis < 3; ++axis) EXPECT_NEAR(mesh.normals[v][axis], normal[axis], 1e-5);
+    }
+
+    // Scattered vertex order, summed in a single chunk.
+    std::vector<uint32_t> order(mesh.numVertices());
+    for (size_t v = 0; v < order.size(); ++v) order[v] = static_cast<uint32_t>((v * 7919) % order.size());
+    SP::IndexedMesh<T> shuffled;
+    shuffled.positions.resize(mesh.numVertices());
+    for (size_t v = 0; v < order.size(); ++v) shuffled.positions[order[v]] = mesh.positions[v];
+    for (const auto index : mesh.indices) shuffled.indices.push_back(order[index]);
+    SP::computeVertexNormals(shuffled, weighting, 4);
+    for (size_t v = 0; v < mesh.numVertices(); ++v)
+      for (int axis = 0; axis < 3; ++axis) EXPECT_NEAR(shuffled.normals[order[v]][axis], serial[v][axis], 1e-6);
+  }
+}
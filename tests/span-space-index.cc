@@ -0,0 +1,178 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright 2019 Lakshman Anumolu.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///////////////////////////////////////////////////////////////////////////////
+
+#include "scalar_polygonization/brick_min_max.h"
+#include "scalar_polygonization/polygonize_volume.h"
+#include "scalar_polygonization/span_space_index.h"
+#include "scalar_polygonization/vec3.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <map>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace SP = SCALAR_POLYGONIZATION;
+
+namespace
+{
+using T = float;
+
+/*! Vertex positions of a mesh by grid edge they lie on.
+ *
+ * Edge is given by its first node and axis, the axis being the coordinate farthest from a node plane.
+ */
+std::map<std::array<int, 4>, SP::Vec3<T>> positionsByEdge(const SP::IndexedMesh<T>& mesh, const T dx)
+{
+  std::map<std::array<int, 4>, SP::Vec3<T>> positions;
+  for (const auto& position : mesh.positions) {
+    std::array<int, 4> edge = {{0, 0, 0, 0}};
+    T max_fraction = -1;
+    for (int axis = 0; axis < 3; ++axis) {
+      const T x = position[axis] / dx;
+      edge[axis] = static_cast<int>(std::round(x));
+      if (std::abs(x - edge[axis]) > max_fraction) {
+        max_fraction = std::abs(x - edge[axis]);
+        edge[3] = axis;
+      }
+    }
+    edge[edge[3]] = static_cast<int>(std::floor(position[edge[3]] / dx));
+    positions[edge] = position;
+  }
+  return positions;
+}
+}  // namespace
+
+TEST(SCALAR_POLYGONIZATION, SPAN_SPACE_INDEX)
+{
+  // Nested spherical shells, so that iso-surfaces of different values lie in different bricks.
+  const SP::Vec3<int> dims(42, 35, 27);
+  const T dx = static_cast<T>(0.05);
+  std::vector<T> field;
+  for (int k = 0; k < dims[2]; ++k)
+    for (int j = 0; j < dims[1]; ++j)
+      for (int i = 0; i < dims[0]; ++i) {
+        const T x = i * dx - 1.05, y = j * dx - 0.85, z = k * dx - 0.65;
+        field.push_back(std::sin(6 * std::sqrt(x * x + y * y + z * z)));
+      }
+
+  const SP::ScalarVolume<T> volume(field.data(), dims, SP::Vec3<T>(0, 0, 0), SP::Vec3<T>(dx, dx, dx));
+  const SP::BrickMinMax<T> bricks(volume);
+  const SP::SpanSpaceIndex<T> index(bricks);
+
+  std::vector<uint32_t> found;
+  for (const T iso_alpha : {-2., -0.5, 0., 0.3, 0.999, 2.}) {
+    index.query(iso_alpha, found);
+
+    std::vector<uint32_t> expected;
+    for (int bk = 0; bk < bricks.numBricks(2); ++bk)
+      for (int bj = 0; bj < bricks.numBricks(1); ++bj)
+        for (int bi = 0; bi < bricks.numBricks(0); ++bi)
+          if (bricks.intersects(bi, bj, bk, iso_alpha))
+            expected.push_back(static_cast<uint32_t>(bi + bricks.numBricks(0) * (bj + bricks.numBricks(1) * bk)));
+    EXPECT_EQ(found, expected);
+
+    // Exact brick bounds as iso-values.
+    for (size_t b = 0; b < expected.size(); b += 7) {
+      const int bi = expected[b] % bricks.numBricks(0);
+      const int bj = expected[b] / bricks.numBricks(0) % bricks.numBricks(1);
+      const int bk = expected[b] / bricks.numBricks(0) / bricks.numBricks(1);
+      for (const T bound : {bricks.min(bi, bj, bk), bricks.max(bi, bj, bk)}) {
+        index.query(bound, found);
+        EXPECT_EQ(std::binary_search(found.begin(), found.end(), expected[b]), bricks.intersects(bi, bj, bk, bound));
+      }
+    }
+  }
+
+  for (const T iso_alpha : {-0.5, 0., 0.3}) {
+    SP::PolygonizeOptions reference_options;
+    reference_options.vertex_edges = true;
+    const auto reference = SP::polygonizeVolume(volume, iso_alpha, reference_options);
+    std::map<uint64_t, T> reference_weights;
+    for (size_t v = 0; v < reference.numVertices(); ++v) reference_weights[reference.edges[v]] = reference.weights[v];
+
+    for (const unsigned num_threads : {1u, 4u}) {
+      SP::PolygonizeOptions options;
+      options.num_threads = num_threads;
+      options.vertex_edges = true;
+      const auto mesh = SP::polygonizeVolume(volume, index, iso_alpha, options);
+
+      ASSERT_EQ(mesh.numVertices(), reference.numVertices());
+      ASSERT_EQ(mesh.numTriangles(), reference.numTriangles());
+
+      // Vertices on brick faces may be interpolated from the other end of their edge.
+      const auto positions = positionsByEdge(mesh, dx), reference_positions = positionsByEdge(reference, dx);
+      ASSERT_EQ(positions.size(), reference_positions.size());
+      for (const auto& vertex : positions) {
+        const auto reference_vertex = reference_positions.find(vertex.first);
+        ASSERT_TRUE(reference_vertex != reference_positions.end());
+        for (int axis = 0; axis < 3; ++axis) EXPECT_NEAR(vertex.second[axis], reference_vertex->second[axis], 1e-6);
+      }
+
+      ASSERT_EQ(mesh.edges.size(), mesh.numVertices());
+      for (size_t v = 0; v < mesh.numVertices(); ++v) {
+        const auto reference_weight = reference_weights.find(mesh.edges[v]);
+        ASSERT_TRUE(reference_weight != reference_weights.end());
+        EXPECT_NEAR(mesh.weights[v], reference_weight->second, 1e-5);
+      }
+
+      // Welded across bricks: every edge is shared by two triangles except on the boundary of the volume.
+      std::map<std::pair<uint32_t, uint32_t>, int> valence;
+      for (size_t t = 0; t < mesh.numTriangles(); ++t)
+        for (int c = 0; c < 3; ++c) {
+          const auto a = mesh.indices[3 * t + c], b = mesh.indices[3 * t + (c + 1) % 3];
+          ++valence[std::make_pair(std::min(a, b), std::max(a, b))];
+        }
+      for (const auto& edge : valence) EXPECT_LE(edge.second, 2);
+      std::map<std::pair<uint32_t, uint32_t>, int> reference_valence;
+      for (size_t t = 0; t < reference.numTriangles(); ++t)
+        for (int c = 0; c < 3; ++c) {
+          const auto a = reference.indices[3 * t + c], b = reference.indices[3 * t + (c + 1) % 3];
+          ++reference_valence[std::make_pair(std::min(a, b), std::max(a, b))];
+        }
+      EXPECT_EQ(valence.size(), reference_valence.size());
+    }
+
+    // Without vertex edges.
+    const auto mesh = SP::polygonizeVolume(volume, index, iso_alpha);
+    EXPECT_EQ(mesh.numVertices(), reference.numVertices());
+    EXPECT_TRUE(mesh.edges.empty() && mesh.weights.empty());
+  }
+
+  // Index of a volume of other dimensions.
+  const SP::ScalarVolume<T> smaller(field.data(), SP::Vec3<int>(dims[0] - 1, dims[1], dims[2]), SP::Vec3<T>(0, 0, 0),
+                                    SP::Vec3<T>(dx, dx, dx));
+  EXPECT_THROW(SP::polygonizeVolume(smaller, index, static_cast<T>(0.)), std::invalid_argument);
+}
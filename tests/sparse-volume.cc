@@ -0,0 +1,236 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright 2019 Lakshman Anumolu.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///////////////////////////////////////////////////////////////////////////////
+
+#include "scalar_polygonization/polygonize_volume.h"
+#include "scalar_polygonization/sparse_volume.h"
+#include "scalar_polygonization/vec3.h"
+#include "test_utilities.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <vector>
+
+namespace SP = SCALAR_POLYGONIZATION;
+namespace SPT = SCALAR_POLYGONIZATION_TESTS;
+
+namespace
+{
+using T = float;
+
+/*! Narrow band of `SPT::sphere` of radius `radius`, sampled on [-1, 1]^3.
+ *
+ * Bricks where values may be within `band` of zero hold the values clamped to [-band, band], others are tiles of
+ * -band inside and band outside.
+ */
+SP::SparseVolume<T> sphereBand(const int n, const T radius, const T band)
+{
+  const T dx = static_cast<T>(2.) / (n - 1);
+  SP::SparseVolume<T> volume(SP::Vec3<int>(n, n, n), SP::Vec3<T>(-1, -1, -1), SP::Vec3<T>(dx, dx, dx), band);
+
+  const int size = SP::SparseVolume<T>::BRICK_SIZE;
+  for (int bk = 0; bk < volume.numBricks(2); ++bk)
+    for (int bj = 0; bj < volume.numBricks(1); ++bj)
+      for (int bi = 0; bi < volume.numBricks(0); ++bi) {
+        // Range of values over the nodes of the brick, from its nearest and farthest points to the origin.
+        const auto low = volume.position(size * bi, size * bj, size * bk);
+        const auto high = volume.position(std::min(size * (bi + 1), n) - 1, std::min(size * (bj + 1), n) - 1,
+                                          std::min(size * (bk + 1), n) - 1);
+        SP::Vec3<T> nearest, farthest;
+        for (int axis = 0; axis < 3; ++axis) {
+          nearest[axis] = std::max(low[axis], std::min(static_cast<T>(0.), high[axis]));
+          farthest[axis] = std::max(std::fabs(low[axis]), std::fabs(high[axis]));
+        }
+        const T min_value = SPT::sphere(nearest, radius), max_value = SPT::sphere(farthest, radius);
+
+        if (min_value > band || max_value < -band) {
+          volume.setTile(bi, bj, bk, max_value < 0 ? -band : band);
+          continue;
+        }
+
+        for (int k = size * bk; k < std::min(size * (bk + 1), n); ++k)
+          for (int j = size * bj; j < std::min(size * (bj + 1), n); ++j)
+            for (int i = size * bi; i < std::min(size * (bi + 1), n); ++i) {
+              const T value = SPT::sphere(volume.position(i, j, k), radius);
+              volume.setValue(i, j, k, std::max(-band, std::min(band, value)));
+            }
+      }
+
+  return volume;
+}
+
+//! Triangles as vertex triples starting at their smallest index, sorted.
+std::vector<std::array<uint32_t, 3>> sortedTriangles(const std::vector<uint32_t>& indices)
+{
+  std::vector<std::array<uint32_t, 3>> triangles;
+  for (size_t t = 0; t < indices.size() / 3; ++t) {
+    const uint32_t* c = &indices[3 * t];
+    const int first = static_cast<int>(std::min_element(c, c + 3) - c);
+    triangles.push_back({{c[first], c[(first + 1) % 3], c[(first + 2) % 3]}});
+  }
+  std::sort(triangles.begin(), triangles.end());
+  return triangles;
+}
+}  // namespace
+
+TEST(SCALAR_POLYGONIZATION, SPARSE_VOLUME)
+{
+  SP::SparseVolume<T> volume(SP::Vec3<int>(20, 9, 17), SP::Vec3<T>(0, 0, 0), SP::Vec3<T>(1, 1, 1), 3);
+
+  EXPECT_EQ(volume.numBricks(0), 3);
+  EXPECT_EQ(volume.numBricks(1), 2);
+  EXPECT_EQ(volume.numBricks(2), 3);
+  EXPECT_EQ(volume.numAllocatedBricks(), static_cast<size_t>(0));
+  EXPECT_EQ(volume.value(19, 8, 16), 3);
+  EXPECT_EQ(volume.brick(2, 1, 2), nullptr);
+
+  // Setting a value allocates its brick filled with the tile value.
+  volume.setTile(1, 0, 2, -2);
+  volume.setValue(9, 3, 16, 5);
+  EXPECT_EQ(volume.numAllocatedBricks(), static_cast<size_t>(1));
+  EXPECT_EQ(volume.value(9, 3, 16), 5);
+  EXPECT_EQ(volume.value(8, 3, 16), -2);
+  ASSERT_NE(volume.brick(1, 0, 2), nullptr);
+  EXPECT_EQ(volume.brick(1, 0, 2)[1 + 8 * (3 + 8 * 0)], 5);
+
+  // Released bricks are reused.
+  volume.setTile(1, 0, 2, 1);
+  EXPECT_EQ(volume.numAllocatedBricks(), static_cast<size_t>(0));
+  EXPECT_EQ(volume.value(9, 3, 16), 1);
+  volume.allocateBrick(0, 1, 0)[0] = 7;
+  EXPECT_EQ(volume.numAllocatedBricks(), static_cast<size_t>(1));
+  EXPECT_EQ(volume.value(0, 8, 0), 7);
+  EXPECT_EQ(volume.value(1, 8, 0), 3);
+}
+
+TEST(SCALAR_POLYGONIZATION, POLYGONIZE_SPARSE_VOLUME)
+{
+  const int n = 45;
+  const T dx = static_cast<T>(2.) / (n - 1);
+  const auto volume = sphereBand(n, static_cast<T>(0.63), 2 * dx);
+
+  const size_t num_bricks = static_cast<size_t>(volume.numBricks(0)) * volume.numBricks(1) * volume.numBricks(2);
+  EXPECT_LT(volume.numAllocatedBricks(), num_bricks / 2);
+
+  // Dense field with the same values.
+  std::vector<T> field;
+  for (int k = 0; k < n; ++k)
+    for (int j = 0; j < n; ++j)
+      for (int i = 0; i < n; ++i) field.push_back(volume.value(i, j, k));
+  const SP::ScalarVolume<T> dense(field.data(), SP::Vec3<int>(n, n, n), SP::Vec3<T>(-1, -1, -1),
+                                  SP::Vec3<T>(dx, dx, dx));
+
+  SP::PolygonizeOptions options;
+  options.vertex_edges = true;
+  const auto expected = SP::polygonizeVolume(dense, static_cast<T>(0.), options);
+  const auto mesh = SP::polygonizeVolume(volume, static_cast<T>(0.), options);
+
+  ASSERT_GT(expected.numTriangles(), static_cast<size_t>(1000));
+  ASSERT_EQ(mesh.numVertices(), expected.numVertices());
+  ASSERT_EQ(mesh.numTriangles(), expected.numTriangles());
+  EXPECT_EQ(mesh.normals.size(), mesh.numVertices());
+
+  // Same vertices, in another order, and the same triangles between them.
+  std::vector<uint32_t> to_expected(mesh.numVertices());
+  std::vector<bool> matched(expected.numVertices(), false);
+  for (size_t v = 0; v < mesh.numVertices(); ++v) {
+    size_t nearest = 0;
+    double nearest_distance = HUGE_VAL;
+    for (size_t w = 0; w < expected.numVertices(); ++w) {
+      const double distance = (mesh.positions[v] - expected.positions[w]).mag();
+      if (distance < nearest_distance) nearest = w, nearest_distance = distance;
+    }
+    ASSERT_LT(nearest_distance, 1e-5);
+    ASSERT_FALSE(matched[nearest]);
+    matched[nearest] = true;
+    to_expected[v] = static_cast<uint32_t>(nearest);
+
+    EXPECT_EQ(mesh.edges[v], expected.edges[nearest]);
+    EXPECT_NEAR(mesh.weights[v], expected.weights[nearest], 1e-6);
+  }
+
+  std::vector<uint32_t> indices(mesh.indices.size());
+  for (size_t c = 0; c < indices.size(); ++c) indices[c] = to_expected[mesh.indices[c]];
+  EXPECT_EQ(sortedTriangles(indices), sortedTriangles(expected.indices));
+
+  // Bricks are concatenated in order whatever the number of threads.
+  options.num_threads = 3;
+  const auto threaded = SP::polygonizeVolume(volume, static_cast<T>(0.), options);
+  EXPECT_EQ(threaded.indices, mesh.indices);
+  ASSERT_EQ(threaded.numVertices(), mesh.numVertices());
+  for (size_t v = 0; v < mesh.numVertices(); ++v) EXPECT_TRUE(threaded.positions[v] == mesh.positions[v]);
+}
+
+TEST(SCALAR_POLYGONIZATION, POLYGONIZE_SPARSE_VOLUME_TILES)
+{
+  // No allocated brick: the surface only comes from tile values on either side of the iso-value.
+  SP::SparseVolume<T> volume(SP::Vec3<int>(30, 25, 20), SP::Vec3<T>(0, 0, 0), SP::Vec3<T>(1, 1, 1), 1);
+  volume.setTile(1, 1, 1, -1);
+  volume.setTile(2, 1, 1, -3);
+  volume.setTile(1, 2, 1, -1);
+  ASSERT_EQ(volume.numAllocatedBricks(), static_cast<size_t>(0));
+
+  std::vector<T> field;
+  for (int k = 0; k < volume.dim(2); ++k)
+    for (int j = 0; j < volume.dim(1); ++j)
+      for (int i = 0; i < volume.dim(0); ++i) field.push_back(volume.value(i, j, k));
+  const SP::ScalarVolume<T> dense(field.data(), SP::Vec3<int>(30, 25, 20), SP::Vec3<T>(0, 0, 0),
+                                  SP::Vec3<T>(1, 1, 1));
+
+  for (const unsigned num_threads : {1u, 3u}) {
+    SP::PolygonizeOptions options;
+    options.num_threads = num_threads;
+    options.vertex_edges = true;
+    const auto expected = SP::polygonizeVolume(dense, static_cast<T>(0.), options);
+    const auto mesh = SP::polygonizeVolume(volume, static_cast<T>(0.), options);
+
+    ASSERT_GT(expected.numTriangles(), static_cast<size_t>(0));
+    ASSERT_EQ(mesh.numVertices(), expected.numVertices());
+    ASSERT_EQ(mesh.numTriangles(), expected.numTriangles());
+
+    // Grid edges identify vertices in both meshes.
+    std::vector<uint64_t> edges = mesh.edges, expected_edges = expected.edges;
+    std::sort(edges.begin(), edges.end());
+    std::sort(expected_edges.begin(), expected_edges.end());
+    EXPECT_EQ(edges, expected_edges);
+
+    std::vector<uint32_t> indices, expected_indices;
+    for (const auto vertex : mesh.indices)
+      indices.push_back(static_cast<uint32_t>(std::lower_bound(edges.begin(), edges.end(), mesh.edges[vertex]) -
+                                              edges.begin()));
+    for (const auto vertex : expected.indices)
+      expected_indices.push_back(static_cast<uint32_t>(
+          std::lower_bound(edges.begin(), edges.end(), expected.edges[vertex]) - edges.begin()));
+    EXPECT_EQ(sortedTriangles(indices), sortedTriangles(expected_indices));
+  }
+}
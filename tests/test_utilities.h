@@ -0,0 +1,80 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright 2019 Lakshman Anumolu.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///////////////////////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include "scalar_polygonization/polygonize_volume.h"
+#include "scalar_polygonization/vec3.h"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace SCALAR_POLYGONIZATION_TESTS
+{
+/*! Squared distance from the origin minus `radius^2`, negative inside the sphere of radius `radius`.
+ */
+template <typename T>
+T sphere(const SCALAR_POLYGONIZATION::Vec3<T>& position, const T radius)
+{
+  return position[0] * position[0] + position[1] * position[1] + position[2] * position[2] - radius * radius;
+}
+
+/*! `sphere` sampled at the nodes of a grid of `dims` nodes spanning [-1, 1] along each axis, x fastest.
+ */
+template <typename T>
+std::vector<T> sphereField(const SCALAR_POLYGONIZATION::Vec3<int>& dims, const T radius)
+{
+  T dx[3];
+  for (int axis = 0; axis < 3; ++axis) dx[axis] = static_cast<T>(2.) / (dims[axis] - 1);
+
+  std::vector<T> field;
+  for (int k = 0; k < dims[2]; ++k)
+    for (int j = 0; j < dims[1]; ++j)
+      for (int i = 0; i < dims[0]; ++i)
+        field.push_back(sphere(SCALAR_POLYGONIZATION::Vec3<T>(-1 + i * dx[0], -1 + j * dx[1], -1 + k * dx[2]), radius));
+  return field;
+}
+
+/*! Expect the same triangles, and bitwise the same vertex positions and normals, in the same order.
+ */
+template <typename T, typename I>
+void expectIdenticalMeshes(const SCALAR_POLYGONIZATION::IndexedMesh<T, I>& mesh,
+                           const SCALAR_POLYGONIZATION::IndexedMesh<T, I>& expected)
+{
+  EXPECT_EQ(mesh.indices, expected.indices);
+  ASSERT_EQ(mesh.numVertices(), expected.numVertices());
+  ASSERT_EQ(mesh.normals.size(), expected.normals.size());
+  for (size_t v = 0; v < mesh.numVertices(); ++v) EXPECT_TRUE(mesh.positions[v] == expected.positions[v]);
+  for (size_t v = 0; v < mesh.normals.size(); ++v) EXPECT_TRUE(mesh.normals[v] == expected.normals[v]);
+}
+}  // namespace SCALAR_POLYGONIZATION_TESTS
@@ -0,0 +1,148 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright 2019 Lakshman Anumolu.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///////////////////////////////////////////////////////////////////////////////
+
+#include "scalar_polygonization/polygonize_volume.h"
+#include "scalar_polygonization/vec3.h"
+#include "scalar_polygonization/volume_file.h"
+#include "test_utilities.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace SP = SCALAR_POLYGONIZATION;
+namespace SPT = SCALAR_POLYGONIZATION_TESTS;
+
+namespace
+{
+using T = float;
+
+const SP::Vec3<int> dims(13, 11, 9);
+
+//! Iso-value of the sphere in `quantizedSphere`.
+const T ISO_ALPHA = 10000;
+
+//! Values of a sphere quantized to 16 bits, `ISO_ALPHA` on the sphere.
+std::vector<uint16_t> quantizedSphere()
+{
+  std::vector<uint16_t> field;
+  for (const T value : SPT::sphereField<T>(dims, 0.7))
+    field.push_back(static_cast<uint16_t>(std::lround(ISO_ALPHA * (value + 1))));
+  return field;
+}
+
+void writeFile(const std::string& path, const std::string& header, const std::vector<uint16_t>& values)
+{
+  std::ofstream file(path, std::ios::binary);
+  file << header;
+  file.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(uint16_t));
+}
+
+}  // namespace
+
+TEST(SCALAR_POLYGONIZATION, VOLUME_FILE_RAW)
+{
+  const auto field = quantizedSphere();
+  const std::string path = ::testing::TempDir() + "sp_volume_file.raw";
+  writeFile(path, "16 byte header..", field);
+
+  const SP::VolumeFile file(path, SP::ScalarType::UINT16, dims, 16);
+  EXPECT_TRUE(file.aligned());
+  EXPECT_TRUE(file.dims() == dims);
+
+  const auto volume = file.volume<T, uint16_t>();
+  EXPECT_EQ(volume(3, 4, 5), field[(5 * dims[1] + 4) * dims[0] + 3]);
+
+  const SP::ScalarVolume<T, uint16_t> expected(field.data(), dims, SP::Vec3<T>(0, 0, 0), SP::Vec3<T>(1, 1, 1));
+  EXPECT_GT(SP::polygonizeVolume(expected, ISO_ALPHA).numTriangles(), 0u);
+  SPT::expectIdenticalMeshes(SP::polygonizeVolume(volume, ISO_ALPHA), SP::polygonizeVolume(expected, ISO_ALPHA));
+
+  EXPECT_THROW((file.volume<T, T>()), std::runtime_error);
+  EXPECT_THROW(SP::VolumeFile(path, SP::ScalarType::FLOAT, dims), std::runtime_error);
+  EXPECT_THROW(SP::VolumeFile(path + ".missing", SP::ScalarType::UINT16, dims), std::runtime_error);
+
+  // Offsets past the end of the file do not wrap around the size check.
+  EXPECT_THROW(SP::VolumeFile(path, SP::ScalarType::UINT16, dims, static_cast<size_t>(-8)), std::runtime_error);
+}
+
+TEST(SCALAR_POLYGONIZATION, VOLUME_FILE_NRRD)
+{
+  const auto field = quantizedSphere();
+  const SP::Vec3<T> origin(-1, 2, 0.5), spacing(0.5, 0.25, 2);
+  const SP::ScalarVolume<T, uint16_t> expected(field.data(), dims, origin, spacing);
+  const auto expected_mesh = SP::polygonizeVolume(expected, ISO_ALPHA);
+  EXPECT_GT(expected_mesh.numTriangles(), 0u);
+
+  const std::string fields =
+      "# Sphere\ntype: ushort\ndimension: 3\nsizes: 13 11 9\nspace dimension: 3\n"
+      "space directions: (0.5,0,0) (0,0.25,0) (0,0,2)\nspace origin: (-1,2,0.5)\nendian: little\nencoding: raw\n";
+
+  // Attached data after a header of odd length, read from the mapping one plane at a time.
+  const std::string attached = ::testing::TempDir() + "sp_volume_file.nrrd";
+  const std::string attached_header = "NRRD0004\n" + fields + "\n";
+  writeFile(attached, attached_header.size() % 2 ? attached_header : "NRRD0004\n# \n" + fields + "\n", field);
+  const SP::VolumeFile attached_file(attached);
+  EXPECT_FALSE(attached_file.aligned());
+  EXPECT_TRUE(attached_file.dims() == dims);
+  EXPECT_THROW((attached_file.volume<T, uint16_t>()), std::runtime_error);
+  for (const unsigned num_threads : {1u, 3u}) {
+    SP::PolygonizeOptions options;
+    options.num_threads = num_threads;
+    SPT::expectIdenticalMeshes(
+        SP::polygonizePlanes(attached_file.planeSampler<T>(), dims, origin, spacing, ISO_ALPHA, options),
+        expected_mesh);
+  }
+
+  // Detached data, mapped in place.
+  const std::string header = ::testing::TempDir() + "sp_volume_file.nhdr";
+  writeFile(::testing::TempDir() + "sp_volume_file_data.raw", "", field);
+  writeFile(header, "NRRD0004\n" + fields + "data file: sp_volume_file_data.raw\n\n", std::vector<uint16_t>());
+  const SP::VolumeFile detached_file(header);
+  EXPECT_TRUE(detached_file.aligned());
+  EXPECT_TRUE(detached_file.spacing() == SP::Vec3<double>(0.5, 0.25, 2));
+  SPT::expectIdenticalMeshes(SP::polygonizeVolume(detached_file.volume<T, uint16_t>(), ISO_ALPHA), expected_mesh);
+
+  writeFile(header, "NRRD0004\ntype: ushort\ndimension: 3\nsizes: 13 11 9\nencoding: gzip\n\n", field);
+  EXPECT_THROW(SP::VolumeFile file(header), std::runtime_error);
+
+  // Attached data without the empty line ending the header, and malformed integer fields.
+  writeFile(attached, "NRRD0004\n" + fields, std::vector<uint16_t>());
+  EXPECT_THROW(SP::VolumeFile file(attached), std::runtime_error);
+  for (const std::string skip :
+       {"byte skip: x\n", "byte skip: 4x\n", "line skip: \n", "line skip: 99999999999999999999\n"}) {
+    writeFile(attached, "NRRD0004\n" + fields + skip + "\n", field);
+    EXPECT_THROW(SP::VolumeFile file(attached), std::runtime_error);
+  }
+}